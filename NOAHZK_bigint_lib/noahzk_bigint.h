@@ -11,11 +11,22 @@
 
 #include "ops/definitions.h"
 #include "ops/logarithms.h"
+#include "ops/cpu.h"
 #include "ops/logic.h"
 #include "ops/type.h"
+#include "ops/shift.h"
 #include "ops/add.h"
 #include "ops/mul.h"
 #include "ops/sub.h"
+#include "ops/montgomery.h"
+#include "ops/pow.h"
+#include "ops/div.h"
+#include "ops/dot.h"
+#include "ops/accumulator.h"
+#include "ops/radix.h"
+#include "ops/container.h"
+#include "ops/batch.h"
+#include "ops/fixed_width.h"
 
 // NAMING SCHEME:
 //      NOAHZK_variable_width_<op>
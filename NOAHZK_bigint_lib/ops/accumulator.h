@@ -0,0 +1,127 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+#ifndef NOAHZK_bigint_accumulator_included
+#define NOAHZK_bigint_accumulator_included
+
+#include "definitions.h"    // NOAHZK variable-width type
+#include "alloc.h"          // NOAHZK_calloc, NOAHZK_free
+#include "sub.h"            // NOAHZK_variable_width_conditionally_invert
+#include "stdint.h"         // integer types
+#include "string.h"         // memset
+
+// carry-save accumulators, for summing many values: every limb of the sum gets a whole NOAHZK_expanded_limb_t column, so the bits above
+// the limb are headroom that carries pile up in. adding a value adds each of its limbs to its column & nothing else, so no carry crosses
+// from one column to the next & the loops vectorise. NOAHZK_accumulator_normalize propagates the carries once, at the end.
+// the sum is kept modulo B^width, like the fixed-width ops, so it works for two's complement values as long as width is wide enough for it.
+// adding & normalising are constant-time, as long as the widths & number of adds are.
+
+// adds a fresh or partially carried accumulator can take before its columns may overflow: each adds less than B to every column,
+// & the columns start below 2B, so B - 3 of them keep every column below B^2 - B, which leaves room for the carries when normalising.
+#define NOAHZK_ACCUMULATOR_HEADROOM (NOAHZK_LIMB_MAX - 2)
+
+typedef struct{
+    size_t width;                       // limbs in the sum
+    size_t headroom;                    // adds left before the columns have to be partially carried
+    NOAHZK_expanded_limb_t* columns;    // the sum is the sum of columns[i]*B^i
+} NOAHZK_accumulator_t;
+
+// initialises toinit to an accumulator of width limbs holding 0, or returns ptr to a new one if NULL is passed for it.
+void* NOAHZK_accumulator_init(NOAHZK_accumulator_t* toinit, const size_t width){
+    if(!toinit) toinit = NOAHZK_malloc(sizeof(NOAHZK_accumulator_t));
+
+    toinit->width = width;
+    toinit->headroom = NOAHZK_ACCUMULATOR_HEADROOM;
+    toinit->columns = width? NOAHZK_calloc(width*sizeof(NOAHZK_expanded_limb_t)): NULL;
+    return toinit;
+}
+
+void NOAHZK_accumulator_destroy(NOAHZK_accumulator_t* const todestroy, const NOAHZK_variable_width_option_t freeptr){
+    if(todestroy->columns){
+        memset(todestroy->columns, 0, todestroy->width*sizeof(NOAHZK_expanded_limb_t));
+        NOAHZK_free(todestroy->columns, todestroy->width*sizeof(NOAHZK_expanded_limb_t));
+    }
+    todestroy->columns = NULL;
+    todestroy->width = todestroy->headroom = 0;
+
+    if(freeptr == NOAHZK_variable_width_free_ptr) NOAHZK_free(todestroy, sizeof(NOAHZK_accumulator_t));
+}
+
+// sets acc back to 0
+void NOAHZK_accumulator_clear(NOAHZK_accumulator_t* const acc){
+    if(acc->columns) memset(acc->columns, 0, acc->width*sizeof(NOAHZK_expanded_limb_t));
+    acc->headroom = NOAHZK_ACCUMULATOR_HEADROOM;
+}
+
+// moves what's above the limb in each column into the next one, all at once, which leaves every column below 2B without changing the sum.
+// what's above the top column is dropped, as the sum is modulo B^width. constant-time
+void NOAHZK_accumulator_carry_primitive(NOAHZK_expanded_limb_t* const columns, const size_t width){
+    for(size_t i = width; i-- > 1;) columns[i] = (columns[i] & NOAHZK_LIMB_MAX) + (columns[i - 1] >> BITS_IN_NOAHZK_LIMB);
+    if(width) columns[0] &= NOAHZK_LIMB_MAX;
+}
+
+// columns += or - (by virtue of op) src, where src is a two's complement array of width_src limbs whose sign is sign.
+// subtracts by adding the complement of src & 1, like NOAHZK_variable_width_add_or_sub. constant-time, regardless of op
+void NOAHZK_accumulator_add_or_sub_primitive(NOAHZK_expanded_limb_t* const restrict columns, const size_t width, const NOAHZK_limb_t* const restrict src, const size_t width_src, NOAHZK_op_t sign, NOAHZK_op_t op){
+    const size_t width_common = NOAHZK_MIN(width, width_src);
+    const NOAHZK_limb_t extension = NOAHZK_variable_width_conditionally_invert(-sign, op);
+
+    for(size_t i = 0; i < width_common; i++) columns[i] += NOAHZK_variable_width_conditionally_invert(src[i], op);
+    for(size_t i = width_common; i < width; i++) columns[i] += extension;
+    if(width) columns[0] += op;
+}
+
+// acc += or - (by virtue of op) src. constant-time, regardless of op
+void NOAHZK_accumulator_add_or_sub(NOAHZK_accumulator_t* const acc, const NOAHZK_variable_width_t* const src, NOAHZK_op_t op){
+    if(!acc->headroom){
+        NOAHZK_accumulator_carry_primitive(acc->columns, acc->width);
+        acc->headroom = NOAHZK_ACCUMULATOR_HEADROOM;
+    }
+    NOAHZK_accumulator_add_or_sub_primitive(acc->columns, acc->width, src->arr, src->width, src->sign, op);
+    acc->headroom--;
+}
+
+// acc += src
+void NOAHZK_accumulator_add(NOAHZK_accumulator_t* const acc, const NOAHZK_variable_width_t* const src){
+    NOAHZK_accumulator_add_or_sub(acc, src, 0);
+}
+
+// acc -= src
+void NOAHZK_accumulator_sub(NOAHZK_accumulator_t* const acc, const NOAHZK_variable_width_t* const src){
+    NOAHZK_accumulator_add_or_sub(acc, src, 1);
+}
+
+// dst = the sum in acc, truncated or sign-extended to dst's width. acc is left as it is, so it can keep accumulating.
+// the only pass that propagates carries serially. constant-time
+void NOAHZK_accumulator_normalize(NOAHZK_variable_width_t* const dst, const NOAHZK_accumulator_t* const acc){
+    const size_t width_common = NOAHZK_MIN(dst->width, acc->width);
+    NOAHZK_expanded_limb_t carry = 0;
+    NOAHZK_limb_t top = 0;
+
+    for(size_t i = 0; i < acc->width; i++){
+        const NOAHZK_expanded_limb_t z = acc->columns[i] + carry;
+        top = z & NOAHZK_LIMB_MAX;
+        if(i < width_common) dst->arr[i] = top;
+        carry = z >> BITS_IN_NOAHZK_LIMB;
+    }
+
+    const NOAHZK_limb_t sign = acc->width? top >> (BITS_IN_NOAHZK_LIMB - 1): 0;
+    for(size_t i = width_common; i < dst->width; i++) dst->arr[i] = -sign;
+    dst->sign = dst->width? NOAHZK_variable_width_get_sign(dst): 0;
+    NOAHZK_variable_width_drop_bitcnt(dst);
+}
+
+// dst = the sum in acc; resizes dst to acc's width.
+void NOAHZK_accumulator_normalize_and_resize(NOAHZK_variable_width_t* const dst, const NOAHZK_accumulator_t* const acc){
+    NOAHZK_variable_width_grow(dst, acc->width);
+    dst->width = acc->width;
+    NOAHZK_accumulator_normalize(dst, acc);
+    NOAHZK_variable_width_auto_trim(dst);
+}
+
+#endif
@@ -10,6 +10,7 @@
 #define NOAHZK_bigint_add_included
 
 #include "definitions.h"    // NOAHZK variable-width type
+#include "cpu.h"            // add_n & sub_n kernels picked for this cpu
 #include "stdint.h"         // integer types
 #include "stdlib.h"         // dynamic memory operations
 #include "string.h"         // memset
@@ -17,9 +18,11 @@
 // do not define any of these as restrict; it is valid for them to alias
 
 NOAHZK_limb_t NOAHZK_variable_width_add_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width_dst, const size_t width0, const size_t width1, const NOAHZK_limb_t sign0, const NOAHZK_limb_t sign1){
-    NOAHZK_limb_t carry = 0;
+// the limbs both sources have go through the kernel picked for this cpu, the rest are extended by their signs
+    const size_t width_common = NOAHZK_MIN(width_dst, NOAHZK_MIN(width0, width1));
+    NOAHZK_limb_t carry = NOAHZK_kernels.add_n(dst, rs0, rs1, width_common);
 
-    for(size_t i = 0; i < width_dst; i++){
+    for(size_t i = width_common; i < width_dst; i++){
         NOAHZK_expanded_limb_t z = NOAHZK_variable_width_get_arr(rs0, width0, sign0, i) + NOAHZK_variable_width_get_arr(rs1, width1, sign1, i) + carry;
         dst[i] = z & NOAHZK_LIMB_MAX;
         carry = NOAHZK_variable_width_get_out(z);
@@ -56,37 +59,30 @@ void NOAHZK_variable_width_add_and_resize(NOAHZK_variable_width_t* const dst, co
     NOAHZK_variable_width_resize_to_largest(dst, rs0->width, rs1->width);
     const NOAHZK_limb_t cout = NOAHZK_variable_width_add_primitive(dst->arr, rs0->arr, rs1->arr, dst->width, rs0->width, rs1->width, rs0->sign, rs1->sign);
     NOAHZK_variable_width_handle_carry(dst, rs0->sign, rs1->sign, cout);
+    NOAHZK_variable_width_auto_trim(dst);
 }
 
 void NOAHZK_variable_width_add_and_resize_constant(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const uint64_t k){
     NOAHZK_variable_width_resize_to_largest(dst, rs0->width, sizeof(k)/sizeof(NOAHZK_limb_t));
     const NOAHZK_limb_t cout = NOAHZK_variable_width_add_constant_primitive(dst->arr, rs0->arr, k, dst->width, rs0->width, rs0->sign);
     NOAHZK_variable_width_handle_carry(dst, rs0->sign, 0, cout);     // constants that are added are ALWAYS positive
+    NOAHZK_variable_width_auto_trim(dst);
 }
 
-void NOAHZK_variable_width_add_with_byte_offset_byte(void* const real_dst, const void* const real_rs0, const void* const real_rs1, const size_t width0, const size_t width1, const size_t width_result, const size_t byte_offset){
-    uint8_t carry = 0;
-    uint8_t* const dst = real_dst;
-    const uint8_t *const rs0 = real_rs0, *const rs1 = real_rs1;
-
-    for(size_t i = 0; i < width_result; i++){
-        uint16_t z = (uint16_t)(i < width0? rs0[i]: 0) + (i < byte_offset? 0: (i-byte_offset < width1? (uint16_t)rs1[i-byte_offset]: 0)) + carry;
-
-        dst[i] = z & UINT8_MAX;
-        carry = z >> BITS_IN_UINT8_T & 1;
-    }
-}
-
-void NOAHZK_variable_width_add_byte(void* const real_dst, const void* const real_rs0, const void* const real_rs1, const size_t width0, const size_t width1, const size_t width_result){
-    uint8_t carry = 0;
-    uint8_t *dst = real_dst;
-    const uint8_t *rs0 = real_rs0, *rs1 = real_rs1;
-
-    for(size_t i = 0; i < width_result; i++){
-        uint16_t z = (uint16_t)(i < width0? rs0[i]: 0) + (uint16_t)(i < width1? rs1[i]: 0) + carry;
-        dst[i] = z & UINT8_MAX;
-        carry = z >> BITS_IN_UINT8_T & 1;
-    }
+// not constant-time; for public operands only.
+// dst = rs0 + rs1, over the operands' significant widths (see NOAHZK_variable_width_significant_width_vartime) rather than their full ones,
+// one limb wider than the wider of them so the sum always fits, then trimmed to the limbs it needs (at least one). dst may alias either.
+void NOAHZK_variable_width_add_and_resize_vartime(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1){
+    const size_t width0 = NOAHZK_variable_width_significant_width_vartime(rs0->arr, rs0->width, rs0->sign);
+    const size_t width1 = NOAHZK_variable_width_significant_width_vartime(rs1->arr, rs1->width, rs1->sign);
+    const size_t width = NOAHZK_MAX(width0, width1) + 1;
+    const NOAHZK_limb_t sign0 = rs0->sign, sign1 = rs1->sign;
+
+    NOAHZK_variable_width_grow(dst, width);
+    NOAHZK_variable_width_add_primitive(dst->arr, rs0->arr, rs1->arr, width, width0, width1, sign0, sign1);
+    dst->width = width;
+    NOAHZK_variable_width_update_sign(dst);
+    NOAHZK_variable_width_normalize_vartime(dst);
 }
 
 #endif
@@ -0,0 +1,288 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+#ifndef NOAHZK_bigint_alloc_included
+#define NOAHZK_bigint_alloc_included
+
+#include "stdint.h"         // integer types
+#include "stdlib.h"         // dynamic memory operations
+#include "string.h"         // memset, memcpy
+
+// every allocation NOAHZK_bigint makes goes through one of two allocators:
+//  - NOAHZK_allocator, for anything that outlives the call that allocated it (variable-width vars, workspaces, contexts).
+//    defaults to the C library's malloc, realloc & free; set it before allocating anything, as what it allocated has to be freed by it.
+//  - the temporary allocator, for temporaries that are freed before the op that allocated them returns.
+//    it's thread-local & defaults to NOAHZK_allocator. set it to an arena or a pool to keep temporaries off the heap;
+//    nothing allocated by it is ever handed to the caller, so a whole batch of ops can be followed by a single reset.
+// the hooks get the size of whatever they free or reallocate, so that arenas & pools don't have to keep headers.
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define NOAHZK_THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__)
+#define NOAHZK_THREAD_LOCAL __thread
+#else
+#define NOAHZK_THREAD_LOCAL         // no thread-local storage; thread-local state is shared by every thread then
+#endif
+
+// alignment of everything arenas & pools hand out
+#ifndef NOAHZK_ALLOC_ALIGNMENT
+#define NOAHZK_ALLOC_ALIGNMENT 16
+#endif
+#define NOAHZK_ALLOC_ROUND_UP(size) (((size) + NOAHZK_ALLOC_ALIGNMENT - 1)/NOAHZK_ALLOC_ALIGNMENT*NOAHZK_ALLOC_ALIGNMENT)
+
+typedef struct{
+    void* (*malloc)(void* const ctx, const size_t size);
+    void* (*realloc)(void* const ctx, void* const ptr, const size_t old_size, const size_t new_size);
+    void  (*free)(void* const ctx, void* const ptr, const size_t size);
+    void* ctx;
+} NOAHZK_allocator_t;
+
+void* NOAHZK_std_malloc(void* const ctx, const size_t size){
+    (void)ctx;
+    return malloc(size);
+}
+
+void* NOAHZK_std_realloc(void* const ctx, void* const ptr, const size_t old_size, const size_t new_size){
+    (void)ctx; (void)old_size;
+    return realloc(ptr, new_size);
+}
+
+void NOAHZK_std_free(void* const ctx, void* const ptr, const size_t size){
+    (void)ctx; (void)size;
+    free(ptr);
+}
+
+NOAHZK_allocator_t NOAHZK_allocator = {NOAHZK_std_malloc, NOAHZK_std_realloc, NOAHZK_std_free, NULL};
+NOAHZK_THREAD_LOCAL const NOAHZK_allocator_t* NOAHZK_temporary_allocator = NULL;
+
+void NOAHZK_set_allocator(const NOAHZK_allocator_t* const allocator){
+    NOAHZK_allocator = *allocator;
+}
+
+// sets the calling thread's temporary allocator; NULL goes back to NOAHZK_allocator. allocator has to outlive its use.
+void NOAHZK_set_temporary_allocator(const NOAHZK_allocator_t* const allocator){
+    NOAHZK_temporary_allocator = allocator;
+}
+
+void* NOAHZK_malloc(const size_t size){
+    return NOAHZK_allocator.malloc(NOAHZK_allocator.ctx, size);
+}
+
+void* NOAHZK_calloc(const size_t size){
+    void* const ptr = NOAHZK_malloc(size);
+    if(ptr) memset(ptr, 0, size);
+    return ptr;
+}
+
+void* NOAHZK_realloc(void* const ptr, const size_t old_size, const size_t new_size){
+    return NOAHZK_allocator.realloc(NOAHZK_allocator.ctx, ptr, old_size, new_size);
+}
+
+void NOAHZK_free(void* const ptr, const size_t size){
+    if(ptr) NOAHZK_allocator.free(NOAHZK_allocator.ctx, ptr, size);
+}
+
+const NOAHZK_allocator_t* NOAHZK_get_temporary_allocator(void){
+    return NOAHZK_temporary_allocator? NOAHZK_temporary_allocator: &NOAHZK_allocator;
+}
+
+void* NOAHZK_temporary_malloc(const size_t size){
+    const NOAHZK_allocator_t* const allocator = NOAHZK_get_temporary_allocator();
+    return allocator->malloc(allocator->ctx, size);
+}
+
+// temporaries get cleared before they're freed, as they may hold secret intermediate values
+void NOAHZK_temporary_free(void* const ptr, const size_t size){
+    if(!ptr) return;
+    const NOAHZK_allocator_t* const allocator = NOAHZK_get_temporary_allocator();
+    memset(ptr, 0, size);
+    allocator->free(allocator->ctx, ptr, size);
+}
+
+// bump arena: hands out memory from blocks it gets from NOAHZK_allocator (as it was when the arena was initialised), by just moving a pointer.
+// freeing (or growing) only does anything for the latest allocation; everything else is freed at once by NOAHZK_arena_reset.
+
+typedef struct NOAHZK_arena_block_t{
+    struct NOAHZK_arena_block_t* next;      // older block
+    size_t capacity, used;                  // in bytes, not counting the header
+} NOAHZK_arena_block_t;
+
+typedef struct{
+    NOAHZK_arena_block_t* head;             // block being allocated from
+    size_t block_size;                      // minimum size of new blocks
+    uint8_t* last;                          // latest allocation, or NULL if it's been freed
+    NOAHZK_allocator_t backing;             // where blocks come from, so an arena can be made NOAHZK_allocator itself
+} NOAHZK_arena_t;
+
+#ifndef NOAHZK_ARENA_BLOCK_SIZE
+#define NOAHZK_ARENA_BLOCK_SIZE 65536
+#endif
+#define NOAHZK_ARENA_HEADER_SIZE NOAHZK_ALLOC_ROUND_UP(sizeof(NOAHZK_arena_block_t))
+
+uint8_t* NOAHZK_arena_block_data(NOAHZK_arena_block_t* const block){
+    return (uint8_t*)block + NOAHZK_ARENA_HEADER_SIZE;
+}
+
+// block_size of 0 means NOAHZK_ARENA_BLOCK_SIZE. doesn't allocate until it's first used.
+void NOAHZK_arena_init(NOAHZK_arena_t* const arena, const size_t block_size){
+    arena->head = NULL;
+    arena->block_size = block_size? block_size: NOAHZK_ARENA_BLOCK_SIZE;
+    arena->last = NULL;
+    arena->backing = NOAHZK_allocator;
+}
+
+void* NOAHZK_arena_malloc(void* const ctx, const size_t size){
+    NOAHZK_arena_t* const arena = ctx;
+    const size_t rounded_size = NOAHZK_ALLOC_ROUND_UP(size);
+
+    if(!arena->head || arena->head->capacity - arena->head->used < rounded_size){
+        const size_t capacity = rounded_size > arena->block_size? rounded_size: arena->block_size;
+        NOAHZK_arena_block_t* const block = arena->backing.malloc(arena->backing.ctx, NOAHZK_ARENA_HEADER_SIZE + capacity);
+        if(!block) return NULL;
+        block->next = arena->head;
+        block->capacity = capacity;
+        block->used = 0;
+        arena->head = block;
+    }
+
+    arena->last = NOAHZK_arena_block_data(arena->head) + arena->head->used;
+    arena->head->used += rounded_size;
+    return arena->last;
+}
+
+void NOAHZK_arena_free(void* const ctx, void* const ptr, const size_t size){
+    NOAHZK_arena_t* const arena = ctx;
+    (void)size;
+    if(ptr && ptr == arena->last){
+        arena->head->used = arena->last - NOAHZK_arena_block_data(arena->head);
+        arena->last = NULL;
+    }
+}
+
+void* NOAHZK_arena_realloc(void* const ctx, void* const ptr, const size_t old_size, const size_t new_size){
+    NOAHZK_arena_t* const arena = ctx;
+    if(!ptr) return NOAHZK_arena_malloc(ctx, new_size);
+
+// the latest allocation grows in place if its block has room
+    if(ptr == arena->last){
+        const size_t offset = arena->last - NOAHZK_arena_block_data(arena->head);
+        if(arena->head->capacity - offset >= NOAHZK_ALLOC_ROUND_UP(new_size)){
+            arena->head->used = offset + NOAHZK_ALLOC_ROUND_UP(new_size);
+            return ptr;
+        }
+    }
+
+    void* const new_ptr = NOAHZK_arena_malloc(ctx, new_size);
+    if(new_ptr) memcpy(new_ptr, ptr, old_size < new_size? old_size: new_size);
+    return new_ptr;
+}
+
+// frees everything allocated from arena at once; keeps its latest block around for reuse. used memory is cleared.
+void NOAHZK_arena_reset(NOAHZK_arena_t* const arena){
+    if(!arena->head) return;
+
+    NOAHZK_arena_block_t* block = arena->head->next;
+    while(block){
+        NOAHZK_arena_block_t* const next = block->next;
+        memset(NOAHZK_arena_block_data(block), 0, block->used);
+        arena->backing.free(arena->backing.ctx, block, NOAHZK_ARENA_HEADER_SIZE + block->capacity);
+        block = next;
+    }
+
+    memset(NOAHZK_arena_block_data(arena->head), 0, arena->head->used);
+    arena->head->next = NULL;
+    arena->head->used = 0;
+    arena->last = NULL;
+}
+
+void NOAHZK_arena_destroy(NOAHZK_arena_t* const arena){
+    NOAHZK_arena_reset(arena);
+    if(arena->head) arena->backing.free(arena->backing.ctx, arena->head, NOAHZK_ARENA_HEADER_SIZE + arena->head->capacity);
+    arena->head = NULL;
+}
+
+NOAHZK_allocator_t NOAHZK_arena_allocator(NOAHZK_arena_t* const arena){
+    const NOAHZK_allocator_t allocator = {NOAHZK_arena_malloc, NOAHZK_arena_realloc, NOAHZK_arena_free, arena};
+    return allocator;
+}
+
+// size-class pool: rounds sizes up to a power of two & keeps a free list per size, so freed memory gets reused right away.
+// the memory itself comes from an arena; sizes past the largest class go straight to it. NOAHZK_pool_reset frees everything at once.
+
+#ifndef NOAHZK_POOL_CLASSES
+#define NOAHZK_POOL_CLASSES 20              // classes of NOAHZK_ALLOC_ALIGNMENT to NOAHZK_ALLOC_ALIGNMENT*2^19 bytes
+#endif
+
+typedef struct{
+    NOAHZK_arena_t arena;
+    void* free_lists[NOAHZK_POOL_CLASSES];  // each free block holds a pointer to the next one
+} NOAHZK_pool_t;
+
+size_t NOAHZK_pool_class(const size_t size){
+    size_t class = 0;
+    while(class < NOAHZK_POOL_CLASSES && ((size_t)NOAHZK_ALLOC_ALIGNMENT << class) < size) class++;
+    return class;
+}
+
+void NOAHZK_pool_init(NOAHZK_pool_t* const pool, const size_t block_size){
+    NOAHZK_arena_init(&pool->arena, block_size);
+    memset(pool->free_lists, 0, sizeof(pool->free_lists));
+}
+
+void* NOAHZK_pool_malloc(void* const ctx, const size_t size){
+    NOAHZK_pool_t* const pool = ctx;
+    const size_t class = NOAHZK_pool_class(size);
+    if(class == NOAHZK_POOL_CLASSES) return NOAHZK_arena_malloc(&pool->arena, size);
+
+    void* const ptr = pool->free_lists[class];
+    if(ptr){
+        memcpy(&pool->free_lists[class], ptr, sizeof(void*));
+        return ptr;
+    }
+    return NOAHZK_arena_malloc(&pool->arena, (size_t)NOAHZK_ALLOC_ALIGNMENT << class);
+}
+
+void NOAHZK_pool_free(void* const ctx, void* const ptr, const size_t size){
+    NOAHZK_pool_t* const pool = ctx;
+    if(!ptr) return;
+    const size_t class = NOAHZK_pool_class(size);
+    if(class == NOAHZK_POOL_CLASSES){ NOAHZK_arena_free(&pool->arena, ptr, size); return; }
+
+    memcpy(ptr, &pool->free_lists[class], sizeof(void*));
+    pool->free_lists[class] = ptr;
+}
+
+void* NOAHZK_pool_realloc(void* const ctx, void* const ptr, const size_t old_size, const size_t new_size){
+    if(!ptr) return NOAHZK_pool_malloc(ctx, new_size);
+    const size_t class = NOAHZK_pool_class(new_size);
+    if(class != NOAHZK_POOL_CLASSES && class == NOAHZK_pool_class(old_size)) return ptr;
+
+    void* const new_ptr = NOAHZK_pool_malloc(ctx, new_size);
+    if(new_ptr){
+        memcpy(new_ptr, ptr, old_size < new_size? old_size: new_size);
+        NOAHZK_pool_free(ctx, ptr, old_size);
+    }
+    return new_ptr;
+}
+
+void NOAHZK_pool_reset(NOAHZK_pool_t* const pool){
+    NOAHZK_arena_reset(&pool->arena);
+    memset(pool->free_lists, 0, sizeof(pool->free_lists));
+}
+
+void NOAHZK_pool_destroy(NOAHZK_pool_t* const pool){
+    NOAHZK_arena_destroy(&pool->arena);
+    memset(pool->free_lists, 0, sizeof(pool->free_lists));
+}
+
+NOAHZK_allocator_t NOAHZK_pool_allocator(NOAHZK_pool_t* const pool){
+    const NOAHZK_allocator_t allocator = {NOAHZK_pool_malloc, NOAHZK_pool_realloc, NOAHZK_pool_free, pool};
+    return allocator;
+}
+
+#endif
@@ -0,0 +1,304 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+#ifndef NOAHZK_bigint_batch_included
+#define NOAHZK_bigint_batch_included
+
+#include "definitions.h"    // NOAHZK variable-width type
+#include "alloc.h"          // NOAHZK_calloc, NOAHZK_free
+#include "type.h"           // NOAHZK_variable_width_option_t
+#include "stdint.h"         // integer types
+#include "string.h"         // memset, memcpy
+
+// batches of count integers, all width limbs wide, stored as structure-of-arrays: limb i of every element is contiguous,
+// so one vector instruction works on limb i of several elements at once. every lane does the same work, so the ops are constant-time.
+// the ops are modulo 2^(width*BITS_IN_NOAHZK_LIMB) like the fixed-width types, which makes them work for two's complement values as well.
+// the kernels are picked when compiling: AVX-512 (with IFMA52 for mul if it's there), then AVX2, then portable C.
+// define NOAHZK_NO_SIMD to always use the portable ones. the vector kernels work on 32-bit limbs, so 64-bit limb builds use the portable ones too.
+
+#if !defined(NOAHZK_NO_SIMD) && NOAHZK_LIMB_BITS != 32
+#define NOAHZK_NO_SIMD
+#endif
+
+#if !defined(NOAHZK_NO_SIMD) && (defined(__AVX2__) || defined(__AVX512F__))
+#include "immintrin.h"      // AVX2 & AVX-512 intrinsics
+#endif
+
+#if !defined(NOAHZK_NO_SIMD) && defined(__AVX512F__)
+#define NOAHZK_BATCH_AVX512
+#endif
+#if !defined(NOAHZK_NO_SIMD) && defined(__AVX512IFMA__)
+#define NOAHZK_BATCH_IFMA
+#endif
+#if !defined(NOAHZK_NO_SIMD) && defined(__AVX2__)
+#define NOAHZK_BATCH_AVX2
+#endif
+
+// elements are padded to a multiple of this, so the kernels never have a partial vector to handle
+#define NOAHZK_BATCH_LANES 16
+// the IFMA kernel's column sums only fit in 64 bits up to this width; wider batches use the AVX-512F one
+#ifndef NOAHZK_BATCH_IFMA_MAX_WIDTH
+#define NOAHZK_BATCH_IFMA_MAX_WIDTH 1024
+#endif
+
+typedef struct{
+    size_t count;           // number of elements
+    size_t width;           // limbs in each element
+    size_t stride;          // count rounded up to NOAHZK_BATCH_LANES; limb i of element j is arr[i*stride + j]
+    NOAHZK_limb_t* arr;
+} NOAHZK_batch_t;
+
+// initialises toinit to count elements, all width limbs wide & 0, or returns ptr to a new batch if NULL is passed for it.
+void* NOAHZK_batch_init(NOAHZK_batch_t* toinit, const size_t count, const size_t width){
+    if(!toinit) toinit = NOAHZK_malloc(sizeof(NOAHZK_batch_t));
+
+    toinit->count = count;
+    toinit->width = width;
+    toinit->stride = NOAHZK_SIZE_AS_ARR_OF_TYPE(count, NOAHZK_BATCH_LANES)*NOAHZK_BATCH_LANES;
+    toinit->arr = toinit->stride && width? NOAHZK_calloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(toinit->stride*width)): NULL;
+    return toinit;
+}
+
+void NOAHZK_batch_destroy(NOAHZK_batch_t* const todestroy, const NOAHZK_variable_width_option_t freeptr){
+    if(todestroy->arr){
+        const size_t width = todestroy->stride*todestroy->width;
+        memset(todestroy->arr, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+        NOAHZK_free(todestroy->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    }
+    todestroy->arr = NULL;
+    todestroy->count = todestroy->width = todestroy->stride = 0;
+
+    if(freeptr == NOAHZK_variable_width_free_ptr) NOAHZK_free(todestroy, sizeof(NOAHZK_batch_t));
+}
+
+// element index of dst = src, sign-extended or truncated to dst->width
+void NOAHZK_batch_set(NOAHZK_batch_t* const dst, const size_t index, const NOAHZK_variable_width_t* const src){
+    for(size_t i = 0; i < dst->width; i++) dst->arr[i*dst->stride + index] = (NOAHZK_limb_t)NOAHZK_variable_width_get_arr(src->arr, src->width, src->sign, i);
+}
+
+// dst = element index of src, sign-extended or truncated to dst->width; dst's sign is set from its top bit
+void NOAHZK_batch_get(NOAHZK_variable_width_t* const dst, const NOAHZK_batch_t* const src, const size_t index){
+    const NOAHZK_limb_t sign = src->width? src->arr[(src->width - 1)*src->stride + index] >> (BITS_IN_NOAHZK_LIMB - 1): 0;
+    for(size_t i = 0; i < dst->width; i++) dst->arr[i] = i < src->width? src->arr[i*src->stride + index]: -sign;
+    dst->sign = dst->width? NOAHZK_variable_width_get_sign(dst): 0;
+    NOAHZK_variable_width_drop_bitcnt(dst);
+}
+
+// portable kernels: NOAHZK_BATCH_LANES lanes at a time, a whole row of limbs per step, with the carries in small arrays
+// so the inner loops have no dependencies between lanes & the compiler can vectorise them.
+
+void NOAHZK_batch_add_portable(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width, const size_t stride){
+    for(size_t j = 0; j < stride; j += NOAHZK_BATCH_LANES){
+        NOAHZK_limb_t carry[NOAHZK_BATCH_LANES] = {0};
+        for(size_t i = 0; i < width; i++)
+            for(size_t l = 0; l < NOAHZK_BATCH_LANES; l++){
+                const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)rs0[i*stride + j + l] + rs1[i*stride + j + l] + carry[l];
+                dst[i*stride + j + l] = (NOAHZK_limb_t)z;
+                carry[l] = NOAHZK_variable_width_get_out(z);
+            }
+    }
+}
+
+void NOAHZK_batch_sub_portable(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width, const size_t stride){
+    for(size_t j = 0; j < stride; j += NOAHZK_BATCH_LANES){
+        NOAHZK_limb_t carry[NOAHZK_BATCH_LANES];
+        for(size_t l = 0; l < NOAHZK_BATCH_LANES; l++) carry[l] = 1;
+        for(size_t i = 0; i < width; i++)
+            for(size_t l = 0; l < NOAHZK_BATCH_LANES; l++){
+                const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)rs0[i*stride + j + l] + (NOAHZK_limb_t)~rs1[i*stride + j + l] + carry[l];
+                dst[i*stride + j + l] = (NOAHZK_limb_t)z;
+                carry[l] = NOAHZK_variable_width_get_out(z);
+            }
+    }
+}
+
+// product scanning: column k sums rs0[i]*rs1[k - i], split into the low & high halves of each product so the sums can't overflow
+void NOAHZK_batch_mul_portable(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width, const size_t stride){
+    for(size_t j = 0; j < stride; j += NOAHZK_BATCH_LANES){
+        NOAHZK_expanded_limb_t carry[NOAHZK_BATCH_LANES] = {0};
+        for(size_t k = 0; k < width; k++){
+            NOAHZK_expanded_limb_t lo[NOAHZK_BATCH_LANES], hi[NOAHZK_BATCH_LANES] = {0};
+            memcpy(lo, carry, sizeof(lo));
+            for(size_t i = 0; i <= k; i++)
+                for(size_t l = 0; l < NOAHZK_BATCH_LANES; l++){
+                    const NOAHZK_expanded_limb_t product = (NOAHZK_expanded_limb_t)rs0[i*stride + j + l]*rs1[(k - i)*stride + j + l];
+                    lo[l] += product & NOAHZK_LIMB_MAX;
+                    hi[l] += product >> BITS_IN_NOAHZK_LIMB;
+                }
+            for(size_t l = 0; l < NOAHZK_BATCH_LANES; l++){
+                dst[k*stride + j + l] = (NOAHZK_limb_t)lo[l];
+                carry[l] = (lo[l] >> BITS_IN_NOAHZK_LIMB) + hi[l];
+            }
+        }
+    }
+}
+
+// AVX2 kernels: 8 lanes for add & sub, 4 for mul, which needs 64-bit lanes for the products.
+// the carries are worked out from the operands' & the sum's top bits, as there's no unsigned compare.
+
+#ifdef NOAHZK_BATCH_AVX2
+void NOAHZK_batch_add_avx2(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width, const size_t stride){
+    for(size_t j = 0; j < stride; j += 8){
+        __m256i carry = _mm256_setzero_si256();
+        for(size_t i = 0; i < width; i++){
+            const __m256i a = _mm256_loadu_si256((const __m256i*)(rs0 + i*stride + j)), b = _mm256_loadu_si256((const __m256i*)(rs1 + i*stride + j));
+            const __m256i sum = _mm256_add_epi32(_mm256_add_epi32(a, b), carry);
+// carry out = (a & b) | ((a | b) & ~sum), in the top bit
+            carry = _mm256_srli_epi32(_mm256_or_si256(_mm256_and_si256(a, b), _mm256_andnot_si256(sum, _mm256_or_si256(a, b))), BITS_IN_NOAHZK_LIMB - 1);
+            _mm256_storeu_si256((__m256i*)(dst + i*stride + j), sum);
+        }
+    }
+}
+
+void NOAHZK_batch_sub_avx2(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width, const size_t stride){
+    for(size_t j = 0; j < stride; j += 8){
+        __m256i borrow = _mm256_setzero_si256();
+        for(size_t i = 0; i < width; i++){
+            const __m256i a = _mm256_loadu_si256((const __m256i*)(rs0 + i*stride + j)), b = _mm256_loadu_si256((const __m256i*)(rs1 + i*stride + j));
+            const __m256i difference = _mm256_sub_epi32(_mm256_sub_epi32(a, b), borrow);
+// borrow out = (~a & b) | (~(a ^ b) & difference), in the top bit
+            borrow = _mm256_srli_epi32(_mm256_or_si256(_mm256_andnot_si256(a, b), _mm256_andnot_si256(_mm256_xor_si256(a, b), difference)), BITS_IN_NOAHZK_LIMB - 1);
+            _mm256_storeu_si256((__m256i*)(dst + i*stride + j), difference);
+        }
+    }
+}
+
+void NOAHZK_batch_mul_avx2(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width, const size_t stride){
+    const __m256i mask = _mm256_set1_epi64x(NOAHZK_LIMB_MAX), even = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    for(size_t j = 0; j < stride; j += 4){
+        __m256i carry = _mm256_setzero_si256();
+        for(size_t k = 0; k < width; k++){
+            __m256i lo = carry, hi = _mm256_setzero_si256();
+            for(size_t i = 0; i <= k; i++){
+                const __m256i a = _mm256_cvtepu32_epi64(_mm_loadu_si128((const __m128i*)(rs0 + i*stride + j)));
+                const __m256i b = _mm256_cvtepu32_epi64(_mm_loadu_si128((const __m128i*)(rs1 + (k - i)*stride + j)));
+                const __m256i product = _mm256_mul_epu32(a, b);
+                lo = _mm256_add_epi64(lo, _mm256_and_si256(product, mask));
+                hi = _mm256_add_epi64(hi, _mm256_srli_epi64(product, BITS_IN_NOAHZK_LIMB));
+            }
+            _mm_storeu_si128((__m128i*)(dst + k*stride + j), _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(lo, even)));
+            carry = _mm256_add_epi64(_mm256_srli_epi64(lo, BITS_IN_NOAHZK_LIMB), hi);
+        }
+    }
+}
+#endif
+
+// AVX-512 kernels: 16 lanes for add & sub, with the carries in a single ternary-logic op, 8 for mul.
+
+#ifdef NOAHZK_BATCH_AVX512
+void NOAHZK_batch_add_avx512(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width, const size_t stride){
+    for(size_t j = 0; j < stride; j += 16){
+        __m512i carry = _mm512_setzero_si512();
+        for(size_t i = 0; i < width; i++){
+            const __m512i a = _mm512_loadu_si512(rs0 + i*stride + j), b = _mm512_loadu_si512(rs1 + i*stride + j);
+            const __m512i sum = _mm512_add_epi32(_mm512_add_epi32(a, b), carry);
+// 0xd4 is (a & b) | ((a | b) & ~sum)
+            carry = _mm512_srli_epi32(_mm512_ternarylogic_epi32(a, b, sum, 0xd4), BITS_IN_NOAHZK_LIMB - 1);
+            _mm512_storeu_si512(dst + i*stride + j, sum);
+        }
+    }
+}
+
+void NOAHZK_batch_sub_avx512(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width, const size_t stride){
+    for(size_t j = 0; j < stride; j += 16){
+        __m512i borrow = _mm512_setzero_si512();
+        for(size_t i = 0; i < width; i++){
+            const __m512i a = _mm512_loadu_si512(rs0 + i*stride + j), b = _mm512_loadu_si512(rs1 + i*stride + j);
+            const __m512i difference = _mm512_sub_epi32(_mm512_sub_epi32(a, b), borrow);
+// 0x8e is (~a & b) | (~(a ^ b) & difference)
+            borrow = _mm512_srli_epi32(_mm512_ternarylogic_epi32(a, b, difference, 0x8e), BITS_IN_NOAHZK_LIMB - 1);
+            _mm512_storeu_si512(dst + i*stride + j, difference);
+        }
+    }
+}
+
+void NOAHZK_batch_mul_avx512(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width, const size_t stride){
+    const __m512i mask = _mm512_set1_epi64(NOAHZK_LIMB_MAX);
+    for(size_t j = 0; j < stride; j += 8){
+        __m512i carry = _mm512_setzero_si512();
+        for(size_t k = 0; k < width; k++){
+            __m512i lo = carry, hi = _mm512_setzero_si512();
+            for(size_t i = 0; i <= k; i++){
+                const __m512i a = _mm512_cvtepu32_epi64(_mm256_loadu_si256((const __m256i*)(rs0 + i*stride + j)));
+                const __m512i b = _mm512_cvtepu32_epi64(_mm256_loadu_si256((const __m256i*)(rs1 + (k - i)*stride + j)));
+                const __m512i product = _mm512_mul_epu32(a, b);
+                lo = _mm512_add_epi64(lo, _mm512_and_si512(product, mask));
+                hi = _mm512_add_epi64(hi, _mm512_srli_epi64(product, BITS_IN_NOAHZK_LIMB));
+            }
+            _mm256_storeu_si256((__m256i*)(dst + k*stride + j), _mm512_cvtepi64_epi32(lo));
+            carry = _mm512_add_epi64(_mm512_srli_epi64(lo, BITS_IN_NOAHZK_LIMB), hi);
+        }
+    }
+}
+#endif
+
+// IFMA52 kernel: madd52lo & madd52hi accumulate the low 52 & the high bits of each product straight into the column sums,
+// so there's no separate multiply, mask & add. only for widths up to NOAHZK_BATCH_IFMA_MAX_WIDTH.
+
+#ifdef NOAHZK_BATCH_IFMA
+void NOAHZK_batch_mul_ifma(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width, const size_t stride){
+    for(size_t j = 0; j < stride; j += 8){
+        __m512i carry = _mm512_setzero_si512();
+        for(size_t k = 0; k < width; k++){
+            __m512i lo = carry, hi = _mm512_setzero_si512();
+            for(size_t i = 0; i <= k; i++){
+                const __m512i a = _mm512_cvtepu32_epi64(_mm256_loadu_si256((const __m256i*)(rs0 + i*stride + j)));
+                const __m512i b = _mm512_cvtepu32_epi64(_mm256_loadu_si256((const __m256i*)(rs1 + (k - i)*stride + j)));
+                lo = _mm512_madd52lo_epu64(lo, a, b);
+                hi = _mm512_madd52hi_epu64(hi, a, b);
+            }
+// the column is lo + hi*2^52
+            _mm256_storeu_si256((__m256i*)(dst + k*stride + j), _mm512_cvtepi64_epi32(lo));
+            carry = _mm512_add_epi64(_mm512_srli_epi64(lo, BITS_IN_NOAHZK_LIMB), _mm512_slli_epi64(hi, 52 - BITS_IN_NOAHZK_LIMB));
+        }
+    }
+}
+#endif
+
+// ops over batches. all of them have to have the same count & width.
+
+// dst = rs0 + rs1, elementwise. dst may alias either source.
+void NOAHZK_batch_add(NOAHZK_batch_t* const dst, const NOAHZK_batch_t* const rs0, const NOAHZK_batch_t* const rs1){
+#if defined(NOAHZK_BATCH_AVX512)
+    NOAHZK_batch_add_avx512(dst->arr, rs0->arr, rs1->arr, dst->width, dst->stride);
+#elif defined(NOAHZK_BATCH_AVX2)
+    NOAHZK_batch_add_avx2(dst->arr, rs0->arr, rs1->arr, dst->width, dst->stride);
+#else
+    NOAHZK_batch_add_portable(dst->arr, rs0->arr, rs1->arr, dst->width, dst->stride);
+#endif
+}
+
+// dst = rs0 - rs1, elementwise. dst may alias either source.
+void NOAHZK_batch_sub(NOAHZK_batch_t* const dst, const NOAHZK_batch_t* const rs0, const NOAHZK_batch_t* const rs1){
+#if defined(NOAHZK_BATCH_AVX512)
+    NOAHZK_batch_sub_avx512(dst->arr, rs0->arr, rs1->arr, dst->width, dst->stride);
+#elif defined(NOAHZK_BATCH_AVX2)
+    NOAHZK_batch_sub_avx2(dst->arr, rs0->arr, rs1->arr, dst->width, dst->stride);
+#else
+    NOAHZK_batch_sub_portable(dst->arr, rs0->arr, rs1->arr, dst->width, dst->stride);
+#endif
+}
+
+// dst = rs0*rs1, elementwise, truncated to the batches' width. dst may not alias either source.
+void NOAHZK_batch_mul(NOAHZK_batch_t* const restrict dst, const NOAHZK_batch_t* const rs0, const NOAHZK_batch_t* const rs1){
+#if defined(NOAHZK_BATCH_IFMA)
+    if(dst->width <= NOAHZK_BATCH_IFMA_MAX_WIDTH){
+        NOAHZK_batch_mul_ifma(dst->arr, rs0->arr, rs1->arr, dst->width, dst->stride);
+        return;
+    }
+#endif
+#if defined(NOAHZK_BATCH_AVX512)
+    NOAHZK_batch_mul_avx512(dst->arr, rs0->arr, rs1->arr, dst->width, dst->stride);
+#elif defined(NOAHZK_BATCH_AVX2)
+    NOAHZK_batch_mul_avx2(dst->arr, rs0->arr, rs1->arr, dst->width, dst->stride);
+#else
+    NOAHZK_batch_mul_portable(dst->arr, rs0->arr, rs1->arr, dst->width, dst->stride);
+#endif
+}
+
+#endif
@@ -0,0 +1,337 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+#ifndef NOAHZK_bigint_container_included
+#define NOAHZK_bigint_container_included
+
+#include "definitions.h"    // NOAHZK variable-width type
+#include "alloc.h"          // NOAHZK_malloc, NOAHZK_realloc, NOAHZK_free
+#include "stdint.h"         // integer types
+#include "string.h"         // memcpy, memcmp
+#include "stdio.h"          // FILE, fopen, fwrite
+
+// binary containers for storing many variable-width vars in one file & reading them back without copying.
+// a container is a 64-byte header, then one record per var, then, unless every record is the same size, an index of where each record starts:
+//      header: "NZKBIGNT", version (u32), limb size in bytes (u8), endianness of the limbs (u8, 1 little & 2 big), 2 unused bytes,
+//              count, stride (limbs per record, or 0 if they vary), where the records start & where the index starts (u64s), 16 unused bytes
+//      record: width in limbs & sign (u64s), then the limbs, padded to a multiple of 8 bytes with the sign extension
+//      index:  where each record starts (u64s)
+// the header, record headers & index are little-endian; the limbs are stored as the writer's cpu stores them, so they can be used in place.
+// records start at multiples of 8 bytes & are padded with the sign extension, so on little-endian cpus a file written with 32-bit limbs can be
+// viewed with 64-bit ones & the other way around. on big-endian ones the halves of a 64-bit limb are the other way round from two 32-bit
+// limbs, so those records can only be loaded (NOAHZK_container_load_and_resize), not viewed.
+// NOAHZK_container_open maps the file read-only (mmap, where there is one; it's read into memory otherwise, or when NOAHZK_NO_MMAP is defined),
+// & NOAHZK_container_view points a var at a record's limbs, so the ops can read it where it lies.
+
+#if !defined(NOAHZK_NO_MMAP) && (defined(__unix__) || defined(__APPLE__))
+#define NOAHZK_CONTAINER_MMAP
+#include "sys/mman.h"       // mmap, munmap
+#include "sys/stat.h"       // fstat
+#include "fcntl.h"          // open
+#include "unistd.h"         // close
+#endif
+
+#define NOAHZK_CONTAINER_MAGIC          "NZKBIGNT"
+#define NOAHZK_CONTAINER_VERSION        1
+#define NOAHZK_CONTAINER_HEADER_SIZE    64
+#define NOAHZK_CONTAINER_LITTLE_ENDIAN  1
+#define NOAHZK_CONTAINER_BIG_ENDIAN     2
+
+// bytes a record of width limbs, limb_size bytes each, takes
+#define NOAHZK_CONTAINER_RECORD_SIZE(width, limb_size) (16 + NOAHZK_SIZE_AS_ARR_OF_TYPE((width)*(limb_size), 8)*8)
+
+typedef struct{
+    const uint8_t* base;        // the whole file
+    size_t size;                // in bytes
+    uint64_t count;             // records in it
+    uint64_t stride;            // limbs per record, or 0 if the records are indexed
+    uint64_t records;           // where the records start
+    uint64_t index;             // where the index starts
+    uint8_t limb_size;          // in bytes
+    uint8_t endianness;
+    uint8_t owned;              // how base was got: 0 passed in, 1 mmap, 2 NOAHZK_malloc
+} NOAHZK_container_t;
+
+typedef struct{
+    FILE* file;
+    uint64_t count;
+    uint64_t stride;
+    uint64_t offset;            // where the next record goes
+    uint64_t* index;            // where each record starts, if they're indexed
+    size_t capacity;            // of index, in entries
+    int failed;                 // set once a write fails
+} NOAHZK_container_writer_t;
+
+uint8_t NOAHZK_container_host_endianness(void){
+    const uint16_t probe = 1;
+    return *(const uint8_t*)&probe? NOAHZK_CONTAINER_LITTLE_ENDIAN: NOAHZK_CONTAINER_BIG_ENDIAN;
+}
+
+void NOAHZK_container_put64(uint8_t* const dst, const uint64_t x){
+    for(size_t i = 0; i < 8; i++) dst[i] = (uint8_t)(x >> 8*i);
+}
+
+uint64_t NOAHZK_container_get64(const uint8_t* const src){
+    uint64_t x = 0;
+    for(size_t i = 0; i < 8; i++) x |= (uint64_t)src[i] << 8*i;
+    return x;
+}
+
+// writing
+
+// writes the header for the records written so far to the start of the file
+void NOAHZK_container_write_header(NOAHZK_container_writer_t* const writer){
+    uint8_t header[NOAHZK_CONTAINER_HEADER_SIZE] = {0};
+    memcpy(header, NOAHZK_CONTAINER_MAGIC, 8);
+    header[8] = NOAHZK_CONTAINER_VERSION;
+    header[12] = sizeof(NOAHZK_limb_t);
+    header[13] = NOAHZK_container_host_endianness();
+    NOAHZK_container_put64(header + 16, writer->count);
+    NOAHZK_container_put64(header + 24, writer->stride);
+    NOAHZK_container_put64(header + 32, NOAHZK_CONTAINER_HEADER_SIZE);
+    NOAHZK_container_put64(header + 40, writer->stride? 0: writer->offset);
+
+    if(fseek(writer->file, 0, SEEK_SET) || fwrite(header, 1, NOAHZK_CONTAINER_HEADER_SIZE, writer->file) != NOAHZK_CONTAINER_HEADER_SIZE) writer->failed = 1;
+}
+
+// starts writing a container to the file at path, replacing it. if stride isn't 0, every record is stride limbs wide,
+// so they can be found without an index; otherwise each var is stored at its own width & the index is written when closing.
+// returns 1, or 0 if the file couldn't be opened.
+int NOAHZK_container_writer_open(NOAHZK_container_writer_t* const writer, const char* const path, const size_t stride){
+    writer->file = fopen(path, "wb");
+    writer->count = 0;
+    writer->stride = stride;
+    writer->offset = NOAHZK_CONTAINER_HEADER_SIZE;
+    writer->index = NULL;
+    writer->capacity = 0;
+    writer->failed = 0;
+    if(!writer->file) return 0;
+
+// a placeholder, until the count is known
+    NOAHZK_container_write_header(writer);
+    return !writer->failed;
+}
+
+// appends src as the next record. with a stride, src is sign-extended to it, & has to fit: returns 0 (appending nothing) if it's wider.
+// returns 0 if writing fails too, 1 otherwise.
+int NOAHZK_container_append(NOAHZK_container_writer_t* const writer, const NOAHZK_variable_width_t* const src){
+    if(writer->failed || (writer->stride && src->width > writer->stride)) return 0;
+
+    const uint64_t width = writer->stride? writer->stride: src->width;
+    const NOAHZK_limb_t extension = -src->sign;
+    const size_t record_size = NOAHZK_CONTAINER_RECORD_SIZE(width, sizeof(NOAHZK_limb_t));
+    const size_t padding = record_size - 16 - width*sizeof(NOAHZK_limb_t);
+
+    if(!writer->stride){
+        if(writer->count == writer->capacity){
+            const size_t new_capacity = NOAHZK_MAX(16, 2*writer->capacity);
+            writer->index = NOAHZK_realloc(writer->index, writer->capacity*sizeof(uint64_t), new_capacity*sizeof(uint64_t));
+            writer->capacity = new_capacity;
+        }
+        writer->index[writer->count] = writer->offset;
+    }
+
+    uint8_t header[16];
+    NOAHZK_container_put64(header, width);
+    NOAHZK_container_put64(header + 8, src->sign);
+    int ok = fwrite(header, 1, 16, writer->file) == 16;
+    if(src->width) ok &= fwrite(src->arr, sizeof(NOAHZK_limb_t), src->width, writer->file) == src->width;
+    for(size_t i = src->width; i < width; i++) ok &= fwrite(&extension, sizeof(NOAHZK_limb_t), 1, writer->file) == 1;
+    if(padding) ok &= fwrite(&extension, 1, padding, writer->file) == padding;
+
+    if(!ok){
+        writer->failed = 1;
+        return 0;
+    }
+    writer->offset += record_size;
+    writer->count++;
+    return 1;
+}
+
+// writes the index & the final header, then closes the file & frees the index.
+// returns 1 if the whole container was written, 0 if anything failed on the way.
+int NOAHZK_container_writer_close(NOAHZK_container_writer_t* const writer){
+    if(!writer->file) return 0;
+
+    if(!writer->stride && !writer->failed){
+        for(uint64_t i = 0; i < writer->count; i++){
+            uint8_t entry[8];
+            NOAHZK_container_put64(entry, writer->index[i]);
+            if(fwrite(entry, 1, 8, writer->file) != 8){
+                writer->failed = 1;
+                break;
+            }
+        }
+    }
+    if(!writer->failed) NOAHZK_container_write_header(writer);
+    if(fclose(writer->file)) writer->failed = 1;
+
+    if(writer->index) NOAHZK_free(writer->index, writer->capacity*sizeof(uint64_t));
+    writer->file = NULL;
+    writer->index = NULL;
+    writer->capacity = 0;
+    return !writer->failed;
+}
+
+// reading
+
+// where record i starts, or 0 if it isn't inside the container or its stored width runs past its space
+uint64_t NOAHZK_container_record(const NOAHZK_container_t* const container, const uint64_t i){
+    if(i >= container->count) return 0;
+    if(container->stride){
+        const uint64_t offset = container->records + i*NOAHZK_CONTAINER_RECORD_SIZE(container->stride, container->limb_size);
+        return NOAHZK_container_get64(container->base + offset) > container->stride? 0: offset;
+    }
+
+    const uint64_t offset = NOAHZK_container_get64(container->base + container->index + 8*i);
+    if(offset < container->records || offset > container->index - 16) return 0;
+    const uint64_t width = NOAHZK_container_get64(container->base + offset);
+    if(width > (container->index - offset - 16)/container->limb_size) return 0;
+    return offset;
+}
+
+// checks the header of the size bytes at base & sets container up to read them. base has to stay valid until the container is closed.
+// returns 1, or 0 if base doesn't hold a container (or one whose records don't fit in it).
+int NOAHZK_container_open_memory(NOAHZK_container_t* const container, const void* const base, const size_t size){
+    const uint8_t* const header = base;
+    if(size < NOAHZK_CONTAINER_HEADER_SIZE || memcmp(header, NOAHZK_CONTAINER_MAGIC, 8)) return 0;
+    if((NOAHZK_container_get64(header + 8) & 0xffffffff) != NOAHZK_CONTAINER_VERSION) return 0;
+    if((header[12] != 4 && header[12] != 8) || (header[13] != NOAHZK_CONTAINER_LITTLE_ENDIAN && header[13] != NOAHZK_CONTAINER_BIG_ENDIAN)) return 0;
+
+    const uint64_t count = NOAHZK_container_get64(header + 16), stride = NOAHZK_container_get64(header + 24);
+    const uint64_t records = NOAHZK_container_get64(header + 32), index = NOAHZK_container_get64(header + 40);
+    if(records < NOAHZK_CONTAINER_HEADER_SIZE || records % 8 || records > size) return 0;
+// every record has to fit, or, if they're indexed, the index does & each record is checked when it's read
+    if(stride){
+        if(stride > size || count > (size - records)/NOAHZK_CONTAINER_RECORD_SIZE(stride, header[12])) return 0;
+    }
+    else if(index < records || index > size || count > (size - index)/8) return 0;
+
+    container->base = header;
+    container->size = size;
+    container->count = count;
+    container->stride = stride;
+    container->records = records;
+    container->index = index;
+    container->limb_size = header[12];
+    container->endianness = header[13];
+    container->owned = 0;
+    return 1;
+}
+
+// opens the container in the file at path, read-only. returns 1, or 0 if it couldn't be read or isn't a container.
+int NOAHZK_container_open(NOAHZK_container_t* const container, const char* const path){
+#ifdef NOAHZK_CONTAINER_MMAP
+    const int fd = open(path, O_RDONLY);
+    if(fd < 0) return 0;
+    struct stat status;
+    if(fstat(fd, &status) || status.st_size <= 0){
+        close(fd);
+        return 0;
+    }
+    const size_t size = (size_t)status.st_size;
+    void* const base = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(base == MAP_FAILED) return 0;
+
+    if(!NOAHZK_container_open_memory(container, base, size)){
+        munmap(base, size);
+        return 0;
+    }
+    container->owned = 1;
+    return 1;
+#else
+    FILE* const file = fopen(path, "rb");
+    if(!file) return 0;
+    long end = -1;
+    if(!fseek(file, 0, SEEK_END)) end = ftell(file);
+    if(end <= 0 || fseek(file, 0, SEEK_SET)){
+        fclose(file);
+        return 0;
+    }
+    const size_t size = (size_t)end;
+    uint8_t* const base = NOAHZK_malloc(size);
+    const size_t size_read = fread(base, 1, size, file);
+    fclose(file);
+
+    if(size_read != size || !NOAHZK_container_open_memory(container, base, size)){
+        NOAHZK_free(base, size);
+        return 0;
+    }
+    container->owned = 2;
+    return 1;
+#endif
+}
+
+// unmaps or frees what NOAHZK_container_open got; views into container mustn't be used afterwards.
+void NOAHZK_container_close(NOAHZK_container_t* const container){
+#ifdef NOAHZK_CONTAINER_MMAP
+    if(container->owned == 1) munmap((void*)container->base, container->size);
+#endif
+    if(container->owned == 2) NOAHZK_free((void*)container->base, container->size);
+    container->base = NULL;
+    container->size = 0;
+    container->count = 0;
+    container->owned = 0;
+}
+
+// points view at record i's limbs, without copying them. view is read-only: it may be passed to any op as a source, but never as a
+// destination, & mustn't be destroyed or resized (its capacity is 0, as it owns nothing).
+// returns 1, or 0 if there's no record i, or its limbs can't be used in place: they were stored in the other byte order, with limbs of the
+// other size on a big-endian cpu, or base isn't aligned.
+int NOAHZK_container_view(NOAHZK_variable_width_t* const view, const NOAHZK_container_t* const container, const uint64_t i){
+    const uint64_t offset = NOAHZK_container_record(container, i);
+    if(!offset || container->endianness != NOAHZK_container_host_endianness()) return 0;
+    if(container->endianness == NOAHZK_CONTAINER_BIG_ENDIAN && container->limb_size != sizeof(NOAHZK_limb_t)) return 0;
+
+    const uint8_t* const limbs = container->base + offset + 16;
+    if((uintptr_t)limbs % sizeof(NOAHZK_limb_t)) return 0;
+
+// the padding holds the sign extension, so (little-endian) a record of 32-bit limbs can be read as 64-bit ones
+    const uint64_t width = NOAHZK_container_get64(container->base + offset);
+    view->width = NOAHZK_SIZE_AS_ARR_OF_TYPE(width*container->limb_size, sizeof(NOAHZK_limb_t));
+    view->arr = view->width? (NOAHZK_limb_t*)limbs: NULL;
+    view->sign = NOAHZK_container_get64(container->base + offset + 8) & 1;
+    NOAHZK_variable_width_drop_bitcnt(view);
+    view->capacity = 0;
+    return 1;
+}
+
+// dst = a copy of record i, whatever byte order & limb size it was stored in; resizes dst to fit it.
+// returns 1, or 0 (leaving dst as it is) if there's no record i.
+int NOAHZK_container_load_and_resize(NOAHZK_variable_width_t* const dst, const NOAHZK_container_t* const container, const uint64_t i){
+    const uint64_t offset = NOAHZK_container_record(container, i);
+    if(!offset) return 0;
+
+    const uint8_t* const limbs = container->base + offset + 16;
+    const size_t limb_size = container->limb_size, bytes = NOAHZK_container_get64(container->base + offset)*limb_size;
+    const size_t width = NOAHZK_SIZE_AS_ARR_OF_TYPE(bytes, sizeof(NOAHZK_limb_t));
+    const NOAHZK_limb_t sign = NOAHZK_container_get64(container->base + offset + 8) & 1;
+    NOAHZK_variable_width_grow(dst, width);
+
+    if(container->endianness == NOAHZK_container_host_endianness() && limb_size == sizeof(NOAHZK_limb_t)){
+        if(width) memcpy(dst->arr, limbs, bytes);
+    }
+    else{
+// byte k of the value is byte k % limb_size of limb k/limb_size, counted from whichever end the file's byte order starts at
+        if(width) memset(dst->arr, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+        for(size_t k = 0; k < width*sizeof(NOAHZK_limb_t); k++){
+            const size_t b = k%limb_size, position = k - b + (container->endianness == NOAHZK_CONTAINER_LITTLE_ENDIAN? b: limb_size - 1 - b);
+            const NOAHZK_limb_t byte = k < bytes? limbs[position]: (uint8_t)-sign;
+            dst->arr[k/sizeof(NOAHZK_limb_t)] |= byte << 8*(k%sizeof(NOAHZK_limb_t));
+        }
+    }
+
+    dst->width = width;
+    dst->sign = sign;
+    NOAHZK_variable_width_drop_bitcnt(dst);
+    NOAHZK_variable_width_auto_trim(dst);
+    return 1;
+}
+
+#endif
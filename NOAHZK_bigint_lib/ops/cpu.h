@@ -0,0 +1,260 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+#ifndef NOAHZK_bigint_cpu_included
+#define NOAHZK_bigint_cpu_included
+
+#include "definitions.h"    // NOAHZK_limb_t, NOAHZK_variable_width_get_out
+#include "stdint.h"         // integer types
+#include "stddef.h"         // ptrdiff_t
+#include "string.h"         // memset, memcpy
+
+// the innermost loops of add, sub & mul, picked once per process for the cpu it runs on.
+// the portable kernels widen every limb to NOAHZK_expanded_limb_t to get its carry out, which keeps compilers from emitting carry chains;
+// on x86-64 there are kernels written in assembly that work on 64-bit words, two 32-bit limbs or one 64-bit limb each:
+//      - add_n & sub_n, with adc & sbb chains, on any x86-64 cpu
+//      - addmul_1 & the mul base case with mulx (BMI2) for the products & adcx/adox (ADX) for two independent carry chains
+// NOAHZK_kernels_init runs before main with GCC & clang, & is called on first use otherwise; it checks cpuid & fills NOAHZK_kernels.
+// all of them are constant-time, as long as the widths are. define NOAHZK_NO_ASM to only ever use the portable ones.
+
+#if !defined(NOAHZK_NO_ASM) && defined(__x86_64__) && defined(__GNUC__)
+#define NOAHZK_KERNELS_X86_64
+#include "cpuid.h"          // __get_cpuid_count
+#endif
+
+// limbs in a 64-bit word
+#define NOAHZK_KERNEL_WORD_LIMBS (sizeof(uint64_t)/sizeof(NOAHZK_limb_t))
+
+typedef struct{
+    NOAHZK_limb_t (*add_n)(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width);
+    NOAHZK_limb_t (*sub_n)(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width);
+    NOAHZK_limb_t (*addmul_1)(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t k, const size_t width);
+    void (*mul_basecase)(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1);
+} NOAHZK_kernels_t;
+
+// portable kernels
+
+// dst = rs0 + rs1 over width limbs; returns the carry out. dst may alias either source.
+NOAHZK_limb_t NOAHZK_kernel_add_n_portable(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width){
+    NOAHZK_limb_t carry = 0;
+    for(size_t i = 0; i < width; i++){
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)rs0[i] + rs1[i] + carry;
+        dst[i] = z & NOAHZK_LIMB_MAX;
+        carry = NOAHZK_variable_width_get_out(z);
+    }
+    return carry;
+}
+
+// dst = rs0 - rs1 over width limbs; returns the carry out like sub_primitive does, 1 if nothing was borrowed. dst may alias either source.
+NOAHZK_limb_t NOAHZK_kernel_sub_n_portable(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width){
+    NOAHZK_limb_t carry = 1;
+    for(size_t i = 0; i < width; i++){
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)rs0[i] + (NOAHZK_limb_t)~rs1[i] + carry;
+        dst[i] = z & NOAHZK_LIMB_MAX;
+        carry = NOAHZK_variable_width_get_out(z);
+    }
+    return carry;
+}
+
+// dst += rs0*k over width limbs; returns the limb carried out.
+NOAHZK_limb_t NOAHZK_kernel_addmul_1_portable(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t k, const size_t width){
+    NOAHZK_limb_t carry = 0;
+    for(size_t i = 0; i < width; i++){
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)rs0[i] * (NOAHZK_expanded_limb_t)k + dst[i] + carry;
+        dst[i] = z & NOAHZK_LIMB_MAX;
+        carry = z >> BITS_IN_NOAHZK_LIMB;
+    }
+    return carry;
+}
+
+// dst = rs0*rs1, writing all width0 + width1 limbs of dst. both widths have to be nonzero. dst may not alias either source.
+void NOAHZK_kernel_mul_basecase_portable(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1){
+    memset(dst, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width0));
+    for(size_t i = 0; i < width1; i++) dst[width0 + i] = NOAHZK_kernel_addmul_1_portable(dst + i, rs0, rs1[i], width0);
+}
+
+// x86-64 kernels. the loops run over words = width/NOAHZK_KERNEL_WORD_LIMBS 64-bit words; with 32-bit limbs, an odd limb left over is handled in C.
+// the addmul loops count up to 0 in rcx & leave with jrcxz, as inc & dec would clobber OF, which adox carries in.
+
+#ifdef NOAHZK_KERNELS_X86_64
+NOAHZK_limb_t NOAHZK_kernel_add_n_x86_64(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width){
+    size_t words = width/NOAHZK_KERNEL_WORD_LIMBS;
+    unsigned char carry = 0;
+    if(words){
+        NOAHZK_limb_t* d = dst; const NOAHZK_limb_t* a = rs0, *b = rs1;
+        __asm__ volatile(
+            "clc\n\t"
+            "1:\n\t"
+            "movq (%[a]), %%rax\n\t"
+            "adcq (%[b]), %%rax\n\t"
+            "movq %%rax, (%[d])\n\t"
+            "leaq 8(%[a]), %[a]\n\t"
+            "leaq 8(%[b]), %[b]\n\t"
+            "leaq 8(%[d]), %[d]\n\t"
+            "decq %[n]\n\t"
+            "jnz 1b\n\t"
+            "setc %[c]"
+            : [a] "+r" (a), [b] "+r" (b), [d] "+r" (d), [n] "+r" (words), [c] "=qm" (carry)
+            :
+            : "rax", "cc", "memory");
+    }
+    if(width % NOAHZK_KERNEL_WORD_LIMBS){
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)rs0[width - 1] + rs1[width - 1] + carry;
+        dst[width - 1] = z & NOAHZK_LIMB_MAX;
+        carry = NOAHZK_variable_width_get_out(z);
+    }
+    return carry;
+}
+
+NOAHZK_limb_t NOAHZK_kernel_sub_n_x86_64(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width){
+    size_t words = width/NOAHZK_KERNEL_WORD_LIMBS;
+    unsigned char borrow = 0;
+    if(words){
+        NOAHZK_limb_t* d = dst; const NOAHZK_limb_t* a = rs0, *b = rs1;
+        __asm__ volatile(
+            "clc\n\t"
+            "1:\n\t"
+            "movq (%[a]), %%rax\n\t"
+            "sbbq (%[b]), %%rax\n\t"
+            "movq %%rax, (%[d])\n\t"
+            "leaq 8(%[a]), %[a]\n\t"
+            "leaq 8(%[b]), %[b]\n\t"
+            "leaq 8(%[d]), %[d]\n\t"
+            "decq %[n]\n\t"
+            "jnz 1b\n\t"
+            "setc %[c]"
+            : [a] "+r" (a), [b] "+r" (b), [d] "+r" (d), [n] "+r" (words), [c] "=qm" (borrow)
+            :
+            : "rax", "cc", "memory");
+    }
+    NOAHZK_limb_t carry = borrow ^ 1;
+    if(width % NOAHZK_KERNEL_WORD_LIMBS){
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)rs0[width - 1] + (NOAHZK_limb_t)~rs1[width - 1] + carry;
+        dst[width - 1] = z & NOAHZK_LIMB_MAX;
+        carry = NOAHZK_variable_width_get_out(z);
+    }
+    return carry;
+}
+
+// dst += rs0*k over words 64-bit words, for a 64-bit k; returns the word carried out.
+// adox adds the previous product's high word to this one's low word while adcx adds that to dst, so neither waits for the other's carry.
+uint64_t NOAHZK_kernel_addmul_words_adx(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const uint64_t k, const size_t words){
+    uint64_t carry;
+    ptrdiff_t i = -(ptrdiff_t)words;
+    __asm__ volatile(
+        "xorl %k[c], %k[c]\n\t"
+        "1:\n\t"
+        "mulxq (%[a],%[i],8), %%rax, %%r9\n\t"
+        "adoxq %[c], %%rax\n\t"
+        "adcxq (%[d],%[i],8), %%rax\n\t"
+        "movq %%rax, (%[d],%[i],8)\n\t"
+        "movq %%r9, %[c]\n\t"
+        "leaq 1(%[i]), %[i]\n\t"
+        "jrcxz 2f\n\t"
+        "jmp 1b\n\t"
+        "2:\n\t"
+        "movl $0, %%eax\n\t"
+        "adoxq %%rax, %[c]\n\t"
+        "adcxq %%rax, %[c]"
+        : [c] "=&r" (carry), [i] "+c" (i)
+        : [a] "r" (rs0 + NOAHZK_KERNEL_WORD_LIMBS*words), [d] "r" (dst + NOAHZK_KERNEL_WORD_LIMBS*words), "d" (k)
+        : "rax", "r9", "cc", "memory");
+    return carry;
+}
+
+NOAHZK_limb_t NOAHZK_kernel_addmul_1_adx(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t k, const size_t width){
+    const size_t words = width/NOAHZK_KERNEL_WORD_LIMBS;
+// k fits in a limb, so the carry word does too
+    NOAHZK_limb_t carry = words? (NOAHZK_limb_t)NOAHZK_kernel_addmul_words_adx(dst, rs0, k, words): 0;
+    if(width % NOAHZK_KERNEL_WORD_LIMBS){
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)rs0[width - 1] * (NOAHZK_expanded_limb_t)k + dst[width - 1] + carry;
+        dst[width - 1] = z & NOAHZK_LIMB_MAX;
+        carry = z >> BITS_IN_NOAHZK_LIMB;
+    }
+    return carry;
+}
+
+// rows of 64-bit multipliers over the whole words of rs0; with 32-bit limbs, an odd limb of rs1 makes a last row with a 32-bit multiplier,
+// & an odd limb of rs0 is added in as a column of its own at the end.
+void NOAHZK_kernel_mul_basecase_adx(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1){
+    const size_t words0 = width0/NOAHZK_KERNEL_WORD_LIMBS, even0 = NOAHZK_KERNEL_WORD_LIMBS*words0;
+    memset(dst, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width0 + width1));
+    if(words0){
+        size_t i = 0;
+        for(; i + NOAHZK_KERNEL_WORD_LIMBS <= width1; i += NOAHZK_KERNEL_WORD_LIMBS){
+            uint64_t k;
+            memcpy(&k, rs1 + i, sizeof(k));
+            const uint64_t carry = NOAHZK_kernel_addmul_words_adx(dst + i, rs0, k, words0);
+            memcpy(dst + i + even0, &carry, sizeof(carry));
+        }
+        if(i < width1) dst[i + even0] = (NOAHZK_limb_t)NOAHZK_kernel_addmul_words_adx(dst + i, rs0, rs1[i], words0);
+    }
+    if(width0 % NOAHZK_KERNEL_WORD_LIMBS) dst[width0 + width1 - 1] = NOAHZK_kernel_addmul_1_adx(dst + width0 - 1, rs1, rs0[width0 - 1], width1);
+}
+#endif
+
+// selection
+
+void NOAHZK_kernels_init(void);
+
+NOAHZK_limb_t NOAHZK_kernel_add_n_resolve(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width);
+NOAHZK_limb_t NOAHZK_kernel_sub_n_resolve(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width);
+NOAHZK_limb_t NOAHZK_kernel_addmul_1_resolve(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t k, const size_t width);
+void NOAHZK_kernel_mul_basecase_resolve(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1);
+
+// until NOAHZK_kernels_init has run, every entry points to a function that runs it & then calls the kernel it picked
+NOAHZK_kernels_t NOAHZK_kernels = {NOAHZK_kernel_add_n_resolve, NOAHZK_kernel_sub_n_resolve, NOAHZK_kernel_addmul_1_resolve, NOAHZK_kernel_mul_basecase_resolve};
+
+// only uses the portable kernels from now on
+void NOAHZK_kernels_init_portable(void){
+    NOAHZK_kernels.add_n = NOAHZK_kernel_add_n_portable;
+    NOAHZK_kernels.sub_n = NOAHZK_kernel_sub_n_portable;
+    NOAHZK_kernels.addmul_1 = NOAHZK_kernel_addmul_1_portable;
+    NOAHZK_kernels.mul_basecase = NOAHZK_kernel_mul_basecase_portable;
+}
+
+// picks the fastest kernels the cpu supports. it's idempotent, so it may be called again at any point.
+#if defined(__GNUC__)
+__attribute__((constructor))
+#endif
+void NOAHZK_kernels_init(void){
+    NOAHZK_kernels_init_portable();
+#ifdef NOAHZK_KERNELS_X86_64
+    NOAHZK_kernels.add_n = NOAHZK_kernel_add_n_x86_64;
+    NOAHZK_kernels.sub_n = NOAHZK_kernel_sub_n_x86_64;
+
+// CPUID leaf 7: EBX bit 8 is BMI2, bit 19 ADX
+    unsigned int eax, ebx, ecx, edx;
+    if(__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx >> 8 & 1) && (ebx >> 19 & 1)){
+        NOAHZK_kernels.addmul_1 = NOAHZK_kernel_addmul_1_adx;
+        NOAHZK_kernels.mul_basecase = NOAHZK_kernel_mul_basecase_adx;
+    }
+#endif
+}
+
+NOAHZK_limb_t NOAHZK_kernel_add_n_resolve(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width){
+    NOAHZK_kernels_init();
+    return NOAHZK_kernels.add_n(dst, rs0, rs1, width);
+}
+
+NOAHZK_limb_t NOAHZK_kernel_sub_n_resolve(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width){
+    NOAHZK_kernels_init();
+    return NOAHZK_kernels.sub_n(dst, rs0, rs1, width);
+}
+
+NOAHZK_limb_t NOAHZK_kernel_addmul_1_resolve(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t k, const size_t width){
+    NOAHZK_kernels_init();
+    return NOAHZK_kernels.addmul_1(dst, rs0, k, width);
+}
+
+void NOAHZK_kernel_mul_basecase_resolve(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1){
+    NOAHZK_kernels_init();
+    NOAHZK_kernels.mul_basecase(dst, rs0, rs1, width0, width1);
+}
+
+#endif
@@ -13,15 +13,29 @@
 #include "stdlib.h"     // dynamic memory handling
 #include "string.h"     // memset, memcpy & so on
 #include "stdio.h"      // DEBUG
-#include "../../../utils.h"     // DEBUG
+#include "alloc.h"      // NOAHZK_malloc, NOAHZK_realloc, NOAHZK_free
 
 #define NOAHZK_BIGINT_OP_ADD 0
 #define NOAHZK_BIGINT_OP_SUB 1
 
+// limbs are 32 bits wide unless NOAHZK_LIMB_BITS is defined as 64 when building; 64-bit limbs halve the number of limb ops,
+// but need unsigned __int128 (GCC & clang on 64-bit targets) for their products.
+#ifndef NOAHZK_LIMB_BITS
+#define NOAHZK_LIMB_BITS 32
+#endif
+
+#if NOAHZK_LIMB_BITS == 64
+typedef uint64_t NOAHZK_limb_t;
+__extension__ typedef unsigned __int128 NOAHZK_expanded_limb_t;    // supposed to be smallest type larger than NOAHZK_limb_t
+#define NOAHZK_LIMB_MAX UINT64_MAX
+#elif NOAHZK_LIMB_BITS == 32
 typedef uint32_t NOAHZK_limb_t;
-typedef const NOAHZK_limb_t NOAHZK_op_t;        // NOAHZK_bigint relies on NOAHZK_op_t secretely being NOAHZK_limb_t, so do not change this!
 typedef uint64_t NOAHZK_expanded_limb_t;        // supposed to be smallest type larger than NOAHZK_limb_t
 #define NOAHZK_LIMB_MAX UINT32_MAX
+#else
+#error "NOAHZK_LIMB_BITS has to be 32 or 64"
+#endif
+typedef const NOAHZK_limb_t NOAHZK_op_t;        // NOAHZK_bigint relies on NOAHZK_op_t secretely being NOAHZK_limb_t, so do not change this!
 
 #define BITS_IN_UINT64_T    64
 #define BITS_IN_UINT32_T    32
@@ -42,7 +56,7 @@ typedef uint64_t NOAHZK_expanded_limb_t;        // supposed to be smallest type
                                     x = (void*)y;       \
                                     y = temp;           \
                                 }
-#define NOAHZK_SIZE_AS_ARR_OF_TYPE(size, size_type) (((size)/size_type) + ((size)%size_type != 0))
+#define NOAHZK_SIZE_AS_ARR_OF_TYPE(size, size_type) (((size)/(size_type)) + ((size)%(size_type) != 0))
 // gets width in limbs of a variable of width x
 #define NOAHZK_GET_LIMB_WIDTH_FROM_INT(x)           ((x)/sizeof(NOAHZK_limb_t) + ((x)%sizeof(NOAHZK_limb_t) != 0))
 #define NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE(x)     ((x). width*sizeof(NOAHZK_limb_t))
@@ -51,14 +65,52 @@ typedef uint64_t NOAHZK_expanded_limb_t;        // supposed to be smallest type
 #define NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(x) ((x)       *sizeof(NOAHZK_limb_t))
 #define NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR_BITS(x) ((x)->width*BITS_IN_NOAHZK_LIMB)
 
-#define NOAHZK_variable_width_INITIALISER {0, NULL, 0}
+// limbs every var has room for inside itself: while its capacity fits in them, its limbs are kept there & it never goes to the allocator,
+// which covers most counters, small coefficients & exponents. growing past them moves the limbs to the heap. 128 bits' worth unless
+// defined otherwise when building; 0 turns it off.
+#ifndef NOAHZK_INLINE_LIMBS
+#define NOAHZK_INLINE_LIMBS (128/NOAHZK_LIMB_BITS)
+#endif
+#if NOAHZK_INLINE_LIMBS < 0
+#error "NOAHZK_INLINE_LIMBS can't be negative"
+#endif
+
+// designated, so it stays valid whichever optional fields are compiled in; those start at 0.
+#define NOAHZK_variable_width_INITIALISER {.width = 0, .arr = NULL, .sign = 0, .capacity = 0}
 
 typedef struct{
     size_t width;
     NOAHZK_limb_t* arr;
     NOAHZK_limb_t sign; 
+    size_t capacity;        // number of limbs arr has room for; always >= width. limbs past width are unspecified.
+#ifdef NOAHZK_CACHE_BITCNT
+    size_t bitcnt;          // 1 + the value's two's complement width in bits, once NOAHZK_variable_width_signed_bitcnt_cached has worked it out; 0 if it isn't known.
+#endif
+#if NOAHZK_INLINE_LIMBS
+    NOAHZK_limb_t inline_limbs[NOAHZK_INLINE_LIMBS];    // where arr points while capacity fits; such a var can't be moved by copying the struct, only by NOAHZK_variable_width_move.
+#endif
 } NOAHZK_variable_width_t;
 
+// 1 if var's limbs are kept inside it, 0 if they're on the heap or it has none
+int NOAHZK_variable_width_is_inline(const NOAHZK_variable_width_t* const var){
+#if NOAHZK_INLINE_LIMBS
+    return var->arr == var->inline_limbs;
+#else
+    (void)var;
+    return 0;
+#endif
+}
+
+// forgets the bit length cached in var when NOAHZK_CACHE_BITCNT is defined, & does nothing otherwise.
+// every op that writes a var calls it where it sets the sign; code that writes to var->arr itself has to call it too.
+void NOAHZK_variable_width_drop_bitcnt(NOAHZK_variable_width_t* const var){
+#ifdef NOAHZK_CACHE_BITCNT
+    var->bitcnt = 0;
+#else
+    (void)var;
+#endif
+}
+
 // SIGN HANDLING RULES:
 //      when an add_and_resize overflows, it sets the extra space to whatever's appropriate:
 //          ADD: (1 == negative, 0 == positive)
@@ -105,15 +157,63 @@ NOAHZK_limb_t NOAHZK_variable_width_get_sign(const NOAHZK_variable_width_t* cons
 
 void NOAHZK_variable_width_update_sign(NOAHZK_variable_width_t* const src){
     src->sign = NOAHZK_variable_width_get_sign(src);
+    NOAHZK_variable_width_drop_bitcnt(src);
 }
 
 // not guaranteed to be constant-time even under assumptions aboce 
 
+// not constant-time; for public values only.
+// the limbs src (width limbs, whose sign is sign) actually needs: leading limbs that are nothing but the sign extension are dropped
+// as long as the limb below them has its top bit equal to sign, so the value read through NOAHZK_variable_width_get_arr stays the same.
+// 0 needs no limbs, -1 needs one.
+size_t NOAHZK_variable_width_significant_width_vartime(const NOAHZK_limb_t* const src, size_t width, const NOAHZK_limb_t sign){
+    const NOAHZK_limb_t extension = -sign;
+    while(width && src[width - 1] == extension && (width == 1? !sign: (src[width - 2] >> (BITS_IN_NOAHZK_LIMB - 1)) == sign)) width--;
+    return width;
+}
+
+// gives var room for capacity limbs, keeping the first ones it has (as many as both capacities hold): inside var if they fit
+// (capacity then becomes NOAHZK_INLINE_LIMBS), on the heap otherwise. the limbs left behind when they move are cleared,
+// like in NOAHZK_variable_width_destroy. a capacity of 0 means var has nothing allocated.
+void NOAHZK_variable_width_set_capacity(NOAHZK_variable_width_t* const var, const size_t capacity){
+#if NOAHZK_INLINE_LIMBS
+    const size_t kept = NOAHZK_MIN(var->capacity, capacity);
+    if(capacity <= NOAHZK_INLINE_LIMBS){
+        if(!NOAHZK_variable_width_is_inline(var)){
+            if(var->capacity){
+                memcpy(var->inline_limbs, var->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(kept));
+                memset(var->arr, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(var->capacity));
+                NOAHZK_free(var->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(var->capacity));
+            }
+            var->arr = var->inline_limbs;
+        }
+        var->capacity = NOAHZK_INLINE_LIMBS;
+        return;
+    }
+    if(NOAHZK_variable_width_is_inline(var)){
+        NOAHZK_limb_t* const arr = NOAHZK_malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(capacity));
+        memcpy(arr, var->inline_limbs, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(kept));
+        memset(var->inline_limbs, 0, sizeof(var->inline_limbs));
+        var->arr = arr;
+        var->capacity = capacity;
+        return;
+    }
+#endif
+    var->arr = NOAHZK_realloc(var->capacity? var->arr: NULL, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(var->capacity), NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(capacity));
+    var->capacity = capacity;
+}
+
+// makes sure dst can hold width limbs without reallocating. grows geometrically, so a loop that keeps growing dst by a limb or so
+// only reallocates O(log(width)) times, and once dst is wide enough it never does again. doesn't change dst->width.
+void NOAHZK_variable_width_grow(NOAHZK_variable_width_t* const dst, const size_t width){
+    if(dst->capacity < width) NOAHZK_variable_width_set_capacity(dst, NOAHZK_MAX(width, 2*dst->capacity));
+}
+
 void NOAHZK_variable_width_resize_to_largest(NOAHZK_variable_width_t* const dst, const size_t width0, const size_t width1){
     const size_t largest_width = NOAHZK_MAX(width0, width1); 
 // expands dst to size of largest operand, initializing new space to 0 
     if(dst->width < largest_width){
-        dst->arr = realloc(dst->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(largest_width));
+        NOAHZK_variable_width_grow(dst, largest_width);
         memset(dst->arr + dst->width, -dst->sign, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(largest_width - dst->width));
         dst->width = largest_width;
     }
@@ -123,27 +223,91 @@ void NOAHZK_variable_width_resize_to_largest(NOAHZK_variable_width_t* const dst,
 // where width0, width1 are widths in number of limbs
 size_t NOAHZK_variable_width_resize_to_sum(NOAHZK_variable_width_t* const dst, const size_t width0, const size_t width1){
     const size_t new_width = width0 + width1;
-    dst->arr = realloc(dst->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(new_width));
+    NOAHZK_variable_width_grow(dst, new_width);
     return new_width;
 }
 
 void NOAHZK_variable_width_resize_by_one(NOAHZK_variable_width_t* const toresize, const NOAHZK_limb_t toput){
-    toresize->arr = realloc(toresize->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(toresize->width + 1));
+    NOAHZK_variable_width_grow(toresize, toresize->width + 1);
     toresize->arr[toresize->width] = toput;
     toresize->width++;
 }
 
+// the _and_resize ops size dst by their operands' widths, not their values, so widths only ever go up: a product is as wide as both
+// factors put together & handle_carry adds a limb whenever a sum might overflow. through a chain of them the widths outgrow the values,
+// & every op after pays for the limbs that hold nothing but the sign extension. these cut them back off.
+
+// not constant-time; for public values only.
+// cuts var down to the limbs its value needs (see NOAHZK_variable_width_significant_width_vartime), keeping at least one, & leaves it
+// canonical: a var whose top bit disagrees with its sign (an unsigned result with the top bit set, say) gets a limb of sign extension,
+// as the signed _and_resize ops only size their results for canonical operands. the value stays as it is & the capacity only grows
+// for that limb; NOAHZK_variable_width_shrink_to_fit gives the memory back.
+void NOAHZK_variable_width_normalize_vartime(NOAHZK_variable_width_t* const var){
+    if(!var->width) return;
+
+    var->width = NOAHZK_MAX(NOAHZK_variable_width_significant_width_vartime(var->arr, var->width, var->sign), 1);
+    if(var->arr[var->width - 1] >> (BITS_IN_NOAHZK_LIMB - 1) != var->sign) NOAHZK_variable_width_resize_by_one(var, -var->sign);
+}
+
+// constant-time, as long as var->width & width are.
+// cuts var down to width limbs, whatever its value, so the width it ends up with gives nothing away; vars no wider are left as they are.
+// returns 1 if only sign extension was cut off, 0 if the value didn't fit, in which case var is left holding it modulo B^width,
+// like the fixed-width ops leave their results. a width of 0 leaves var as 0, which only fits if it was 0.
+NOAHZK_limb_t NOAHZK_variable_width_trim(NOAHZK_variable_width_t* const var, const size_t width){
+    if(var->width <= width) return 1;
+
+    const NOAHZK_limb_t extension = -var->sign;
+    NOAHZK_limb_t difference = width? (var->arr[width - 1] >> (BITS_IN_NOAHZK_LIMB - 1)) ^ var->sign: var->sign;
+    for(size_t i = width; i < var->width; i++) difference |= var->arr[i] ^ extension;
+
+    var->width = width;
+    if(width) NOAHZK_variable_width_update_sign(var);
+    else{
+        var->sign = 0;
+        NOAHZK_variable_width_drop_bitcnt(var);
+    }
+    return (NOAHZK_limb_t)((difference | -difference) >> (BITS_IN_NOAHZK_LIMB - 1)) ^ 1;
+}
+
+typedef enum{
+    NOAHZK_variable_width_trim_never = 0,           // results keep the width the op sized them to (default)
+    NOAHZK_variable_width_trim_after_resize = 1,    // every _and_resize op normalises its result before returning
+} NOAHZK_variable_width_trim_policy_t;
+
+// off by default, as a normalised result's width depends on its value, which would leak it for secret ones.
+NOAHZK_THREAD_LOCAL NOAHZK_variable_width_trim_policy_t NOAHZK_variable_width_trim_policy = NOAHZK_variable_width_trim_never;
+
+// sets the calling thread's trim policy & returns the one it replaces, so a chain of ops on public values can turn it on & put it back after
+NOAHZK_variable_width_trim_policy_t NOAHZK_variable_width_set_trim_policy(const NOAHZK_variable_width_trim_policy_t policy){
+    const NOAHZK_variable_width_trim_policy_t previous = NOAHZK_variable_width_trim_policy;
+    NOAHZK_variable_width_trim_policy = policy;
+    return previous;
+}
+
+// what the _and_resize ops call on their results
+void NOAHZK_variable_width_auto_trim(NOAHZK_variable_width_t* const dst){
+    if(NOAHZK_variable_width_trim_policy == NOAHZK_variable_width_trim_after_resize) NOAHZK_variable_width_normalize_vartime(dst);
+}
+
+// prints var's sign, width & limbs in hex, most significant first, then end. for debugging; radix.h has the conversions to strings.
+void NOAHZK_variable_width_print_end(const NOAHZK_variable_width_t* const var, const char end){
+    printf("%u %zu ", (unsigned)var->sign, var->width);
+    for(size_t i = var->width; i-- > 0;) printf("%0*llx", (int)(2*sizeof(NOAHZK_limb_t)), (unsigned long long)var->arr[i]);
+    putchar(end);
+}
+
 void NOAHZK_variable_width_print(const NOAHZK_variable_width_t* const var){
-    printf("%u %lu ", var->sign, var->width); print_hex_reverse(var->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(var), '\n');
+    NOAHZK_variable_width_print_end(var, '\n');
 }
 
 void NOAHZK_variable_width_print_nonewline(const NOAHZK_variable_width_t* const var){
-    printf("%u %lu ", var->sign, var->width); print_hex_reverse(var->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(var), ' ');
+    NOAHZK_variable_width_print_end(var, ' ');
 }
 
 void NOAHZK_variable_width_handle_carry(NOAHZK_variable_width_t* const dst, const NOAHZK_limb_t rs0_sign, const NOAHZK_limb_t rs1_sign, const NOAHZK_limb_t cout){
 // this is to allow unsigned & signed resize ops
 // see table above
+    NOAHZK_variable_width_drop_bitcnt(dst);
     if(rs0_sign && rs1_sign) dst->sign = NOAHZK_variable_width_get_sign(dst);
     else dst->sign = (rs0_sign | rs1_sign) & (cout ^ 1);
 
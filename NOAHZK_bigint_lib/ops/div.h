@@ -0,0 +1,339 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+#ifndef NOAHZK_bigint_div_included
+#define NOAHZK_bigint_div_included
+
+#include "definitions.h"    // NOAHZK variable-width type
+#include "alloc.h"          // NOAHZK_temporary_malloc
+#include "logarithms.h"     // NOAHZK_min_bitcnt_var
+#include "type.h"           // ops to allocate, destroy variable width types
+#include "logic.h"          // NOAHZK_variable_width_negate_conditionally_primitive
+#include "sub.h"            // NOAHZK_variable_width_sub_primitive
+#include "mul.h"            // NOAHZK_variable_width_mul_limb
+#include "workspace.h"      // scratch for Barrett reduction
+#include "shift.h"          // NOAHZK_variable_width_shift_left_primitive
+#include "stdint.h"         // integer types
+#include "string.h"         // memset, memcpy
+
+// tunable threshold, in limbs of the divisor, above which reciprocals are found by Newton's iteration instead of a single long division
+#ifndef NOAHZK_DIV_NEWTON_THRESHOLD
+#define NOAHZK_DIV_NEWTON_THRESHOLD 32
+#endif
+// the iteration recurses on ceil(k/2) + 1 limbs, which only shrinks them from 4 limbs up
+#if NOAHZK_DIV_NEWTON_THRESHOLD < 3
+#error "NOAHZK_DIV_NEWTON_THRESHOLD has to be at least 3"
+#endif
+
+// division with quotient & remainder. signed division truncates, like C's: the quotient is rounded towards 0
+// & the remainder has the sign of the dividend, so rs0 = quot*rs1 + rem.
+// the primitives work on unsigned limb arrays; the var ops take the absolute values first & fix the signs up afterwards.
+
+// unsigned primitives
+
+// not constant-time
+// quot = rs0/rs1 & rem = rs0 % rs1 with Knuth's algorithm D: one quotient limb per step, estimated from the top limbs & corrected at most twice.
+// requires width0 >= width1 >= 1 & rs1[width1 - 1] != 0. quot is width0 - width1 + 1 limbs wide & rem width1.
+// neither may alias a source. scratch has to be width0 + width1 + 1 limbs wide.
+void NOAHZK_variable_width_divrem_vartime_primitive(NOAHZK_limb_t* const restrict quot, NOAHZK_limb_t* const restrict rem, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, NOAHZK_limb_t* const scratch){
+    if(width1 == 1){
+        NOAHZK_expanded_limb_t r = 0;
+        for(size_t i = width0; i-- > 0;){
+            const NOAHZK_expanded_limb_t z = r << BITS_IN_NOAHZK_LIMB | rs0[i];
+            quot[i] = (NOAHZK_limb_t)(z/rs1[0]);
+            r = z%rs1[0];
+        }
+        rem[0] = (NOAHZK_limb_t)r;
+        return;
+    }
+
+// both operands are shifted left until the divisor's top bit is set, so the estimates are off by 2 at most
+    const size_t shamt = BITS_IN_NOAHZK_LIMB - NOAHZK_min_bitcnt_var(rs1[width1 - 1]);
+    NOAHZK_limb_t* const v = scratch, *const u = scratch + width1;
+    NOAHZK_variable_width_shift_left_primitive(v, rs1, width1, width1, 0, shamt);
+    NOAHZK_variable_width_shift_left_primitive(u, rs0, width0 + 1, width0, 0, shamt);
+
+    const NOAHZK_expanded_limb_t base = (NOAHZK_expanded_limb_t)1 << BITS_IN_NOAHZK_LIMB;
+    for(size_t j = width0 - width1 + 1; j-- > 0;){
+        const NOAHZK_expanded_limb_t top = (NOAHZK_expanded_limb_t)u[j + width1] << BITS_IN_NOAHZK_LIMB | u[j + width1 - 1];
+        NOAHZK_expanded_limb_t qhat = top/v[width1 - 1], rhat = top%v[width1 - 1];
+        while(qhat >= base || qhat*v[width1 - 2] > (rhat << BITS_IN_NOAHZK_LIMB | u[j + width1 - 2])){
+            qhat--;
+            rhat += v[width1 - 1];
+            if(rhat >= base) break;
+        }
+
+// u[j, j + width1] -= qhat*v
+        NOAHZK_limb_t carry = 0, no_borrow = 1;
+        for(size_t i = 0; i < width1; i++){
+            const NOAHZK_expanded_limb_t product = qhat*v[i] + carry;
+            carry = product >> BITS_IN_NOAHZK_LIMB;
+            const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)u[i + j] + (NOAHZK_limb_t)~(NOAHZK_limb_t)product + no_borrow;
+            u[i + j] = z & NOAHZK_LIMB_MAX;
+            no_borrow = NOAHZK_variable_width_get_out(z);
+        }
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)u[j + width1] + (NOAHZK_limb_t)~carry + no_borrow;
+        u[j + width1] = z & NOAHZK_LIMB_MAX;
+
+// qhat was one too large; adds v back
+        if(!NOAHZK_variable_width_get_out(z)){
+            qhat--;
+            u[j + width1] += NOAHZK_variable_width_add_primitive(u + j, u + j, v, width1, width1, width1, 0, 0);
+        }
+        quot[j] = (NOAHZK_limb_t)qhat;
+    }
+
+    NOAHZK_variable_width_shift_right_primitive(rem, u, width1, width1 + 1, 0, shamt);
+}
+
+// limbs of scratch NOAHZK_variable_width_reciprocal_vartime_primitive needs for a divisor of width limbs
+size_t NOAHZK_variable_width_reciprocal_vartime_scratch_size(const size_t width){
+    if(width <= NOAHZK_DIV_NEWTON_THRESHOLD) return (2*width + 1) + (width + 2) + width + (3*width + 2);
+
+    const size_t h = width - width/2 + 1;
+    const size_t width_step = (width + 1) + (width + h + 2) + 2*(width + 2) + NOAHZK_variable_width_mul_limb_scratch_size(width, width + 1);
+    return (h + 1) + NOAHZK_MAX(NOAHZK_variable_width_reciprocal_vartime_scratch_size(h), width_step);
+}
+
+// not constant-time
+// mu = floor(B^2k/rs1), where rs1 is k limbs wide & normalised (its top bit is set), so mu is k + 1 limbs wide.
+// up to NOAHZK_DIV_NEWTON_THRESHOLD limbs, B^2k is divided by rs1 outright; above, the reciprocal X of the top h = ceil(k/2) + 1 limbs
+// is found recursively & taken through one step of Newton's iteration, X*B^l + X*(B^(k+h) - rs1*X)/B^2h, where l = k - h.
+// that's within a few units of mu, so it's corrected by adding or subtracting rs1 to the remainder B^2k - rs1*mu until it's in [0, rs1).
+// mu may not alias rs1. scratch has to be NOAHZK_variable_width_reciprocal_vartime_scratch_size(k) limbs wide.
+void NOAHZK_variable_width_reciprocal_vartime_primitive(NOAHZK_limb_t* const restrict mu, const NOAHZK_limb_t* const rs1, const size_t width, NOAHZK_limb_t* const scratch){
+    if(width <= NOAHZK_DIV_NEWTON_THRESHOLD){
+        const size_t width_power = 2*width + 1;
+        NOAHZK_limb_t* const power = scratch, *const quot = power + width_power, *const rem = quot + width + 2, *const scratch_div = rem + width;
+        memset(power, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_power));
+        power[2*width] = 1;
+        NOAHZK_variable_width_divrem_vartime_primitive(quot, rem, power, rs1, width_power, width, scratch_div);
+        memcpy(mu, quot, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width + 1));
+        return;
+    }
+
+    const size_t h = width - width/2 + 1, l = width - h;
+    NOAHZK_limb_t* const x = scratch, *const error = x + h + 1, *const correction = error + width + 1;
+    NOAHZK_limb_t* const r = correction + width + h + 2, *const difference = r + width + 2, *const scratch_mul = difference + width + 2;
+    NOAHZK_variable_width_reciprocal_vartime_primitive(x, rs1 + l, h, error);
+
+// error = B^(k+h) - rs1*x, which is below 2B^k in magnitude, so it's exact modulo B^(k+1) as a signed number
+    NOAHZK_variable_width_mul_limb_scratch(error, rs1, x, width, h + 1, width + 1, scratch_mul);
+    NOAHZK_variable_width_negate_conditionally_primitive(error, error, width + 1, 1);
+    const NOAHZK_limb_t sign_error = error[width] >> (BITS_IN_NOAHZK_LIMB - 1);
+
+// mu = x*B^l + (x*error >> 2h limbs)
+    NOAHZK_variable_width_mul_signed_limb_scratch(correction, x, error, h + 1, width + 1, 0, sign_error, width + h + 2, scratch_mul);
+    memset(mu, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(l));
+    memcpy(mu + l, x, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(h + 1));
+    NOAHZK_variable_width_add_primitive(mu, mu, correction + 2*h, width + 1, width + 1, l + 2, 0, sign_error);
+
+// r = B^2k - rs1*mu, modulo B^(k+2) & as a signed number
+    NOAHZK_variable_width_mul_limb_scratch(r, rs1, mu, width, width + 1, width + 2, scratch_mul);
+    NOAHZK_variable_width_negate_conditionally_primitive(r, r, width + 2, 1);
+    while(r[width + 1] >> (BITS_IN_NOAHZK_LIMB - 1)){
+        NOAHZK_variable_width_sub_constant_primitive(mu, mu, 1, width + 1, width + 1, 0);
+        NOAHZK_variable_width_add_primitive(r, r, rs1, width + 2, width + 2, width, 0, 0);
+    }
+    while(NOAHZK_variable_width_sub_primitive(difference, r, rs1, width + 2, width + 2, width, 0, 0)){
+        NOAHZK_variable_width_add_constant_primitive(mu, mu, 1, width + 1, width + 1, 0);
+        memcpy(r, difference, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width + 2));
+    }
+}
+
+// quot = rs0/rs1 & rem = rs0 % rs1, where quot is width0 limbs wide & rem width1; rs1 may have leading zero limbs.
+// binary long division: every bit of rs0 is shifted into the running remainder, which has rs1 subtracted by mask whenever it isn't smaller.
+// the same work for any values of the given widths; constant-time. if rs1 is 0, quot ends up all ones & rem is rs0 truncated.
+// neither may alias a source. scratch has to be 2*(width1 + 1) limbs wide.
+void NOAHZK_variable_width_divrem_primitive(NOAHZK_limb_t* const restrict quot, NOAHZK_limb_t* const restrict rem, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, NOAHZK_limb_t* const scratch){
+    const size_t width_r = width1 + 1;
+    NOAHZK_limb_t* const r = scratch, *const difference = scratch + width_r;
+    memset(r, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_r));
+    memset(quot, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width0));
+
+    for(size_t i = width0*BITS_IN_NOAHZK_LIMB; i-- > 0;){
+// r = 2r + bit i of rs0; r < rs1 beforehand, so it fits in width1 + 1 limbs
+        NOAHZK_limb_t carry = (rs0[i/BITS_IN_NOAHZK_LIMB] >> (i%BITS_IN_NOAHZK_LIMB)) & 1;
+        for(size_t j = 0; j < width_r; j++){
+            const NOAHZK_limb_t out = r[j] >> (BITS_IN_NOAHZK_LIMB - 1);
+            r[j] = r[j] << 1 | carry;
+            carry = out;
+        }
+
+        const NOAHZK_limb_t no_borrow = NOAHZK_variable_width_sub_primitive(difference, r, rs1, width_r, width_r, width1, 0, 0);
+        const NOAHZK_limb_t mask = -no_borrow;
+        for(size_t j = 0; j < width_r; j++) r[j] = (difference[j] & mask) | (r[j] & ~mask);
+        quot[i/BITS_IN_NOAHZK_LIMB] |= no_borrow << (i%BITS_IN_NOAHZK_LIMB);
+    }
+
+    memcpy(rem, r, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width1));
+}
+
+// signed ops over variable-width vars
+
+// dst = op? -src: src, where src is width_src limbs wide, zero-extended (or truncated) to dst's width
+void NOAHZK_variable_width_div_store(NOAHZK_variable_width_t* const dst, const NOAHZK_limb_t* const src, const size_t width_src, NOAHZK_op_t op){
+    for(size_t i = 0; i < dst->width; i++) dst->arr[i] = NOAHZK_variable_width_get_arr(src, width_src, 0, i);
+    NOAHZK_variable_width_negate_conditionally_primitive(dst->arr, dst->arr, dst->width, op);
+    dst->sign = dst->width? NOAHZK_variable_width_get_sign(dst): 0;
+    NOAHZK_variable_width_drop_bitcnt(dst);
+}
+
+// quot = rs0/rs1, rem = rs0 % rs1; both keep their widths, & either may be NULL if it isn't needed.
+// constant-time, regardless of the values of rs0 & rs1. returns 0 if rs1 is 0 (quot & rem are meaningless then), 1 otherwise.
+// quot & rem may alias either source.
+int NOAHZK_variable_width_divrem(NOAHZK_variable_width_t* const quot, NOAHZK_variable_width_t* const rem, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1){
+    const size_t width0 = rs0->width, width1 = rs1->width;
+    const size_t width_scratch = 2*width0 + width1 + 2*(width1 + 1) + width1;
+    NOAHZK_limb_t* const abs_rs0 = NOAHZK_temporary_malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+    NOAHZK_limb_t* const abs_rs1 = abs_rs0 + width0, *const q = abs_rs1 + width1, *const r = q + width0, *const scratch = r + width1;
+    NOAHZK_variable_width_negate_conditionally_primitive(abs_rs0, rs0->arr, width0, rs0->sign);
+    NOAHZK_variable_width_negate_conditionally_primitive(abs_rs1, rs1->arr, width1, rs1->sign);
+
+    NOAHZK_limb_t nonzero = 0;
+    for(size_t i = 0; i < width1; i++) nonzero |= abs_rs1[i];
+    nonzero = (nonzero | -nonzero) >> (BITS_IN_NOAHZK_LIMB - 1);
+
+    NOAHZK_variable_width_divrem_primitive(q, r, abs_rs0, abs_rs1, width0, width1, scratch);
+
+    const NOAHZK_limb_t sign0 = rs0->sign, sign1 = rs1->sign;
+    if(quot) NOAHZK_variable_width_div_store(quot, q, width0, sign0 ^ sign1);
+    if(rem) NOAHZK_variable_width_div_store(rem, r, width1, sign0);
+
+    NOAHZK_temporary_free(abs_rs0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+    return (int)nonzero;
+}
+
+// quot = rs0/rs1, rem = rs0 % rs1, with Knuth's algorithm D; either may be NULL if it isn't needed.
+// quot is resized to rs0->width + 1 limbs & rem to rs1->width + 1, enough for any quotient & remainder along with their signs.
+// returns 0 (& leaves quot & rem as they are) if rs1 is 0, 1 otherwise. quot & rem may alias either source.
+int NOAHZK_variable_width_divrem_and_resize(NOAHZK_variable_width_t* const quot, NOAHZK_variable_width_t* const rem, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1){
+    const size_t width0 = rs0->width, width1 = rs1->width;
+    const size_t width_scratch = 2*width0 + 2*width1 + 2 + width0 + width1 + 1;
+    NOAHZK_limb_t* const abs_rs0 = NOAHZK_temporary_malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+    NOAHZK_limb_t* const abs_rs1 = abs_rs0 + width0, *const q = abs_rs1 + width1, *const r = q + width0 + 1, *const scratch = r + width1 + 1;
+    NOAHZK_variable_width_negate_conditionally_primitive(abs_rs0, rs0->arr, width0, rs0->sign);
+    NOAHZK_variable_width_negate_conditionally_primitive(abs_rs1, rs1->arr, width1, rs1->sign);
+
+    size_t trimmed0 = width0, trimmed1 = width1;
+    while(trimmed0 && !abs_rs0[trimmed0 - 1]) trimmed0--;
+    while(trimmed1 && !abs_rs1[trimmed1 - 1]) trimmed1--;
+    if(!trimmed1){
+        NOAHZK_temporary_free(abs_rs0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+        return 0;
+    }
+
+    size_t width_q = 0, width_r = trimmed0;
+    if(trimmed0 < trimmed1) memcpy(r, abs_rs0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(trimmed0));
+    else{
+        NOAHZK_variable_width_divrem_vartime_primitive(q, r, abs_rs0, abs_rs1, trimmed0, trimmed1, scratch);
+        width_q = trimmed0 - trimmed1 + 1;
+        width_r = trimmed1;
+    }
+
+    const NOAHZK_limb_t sign0 = rs0->sign, sign1 = rs1->sign;
+    if(quot){
+        NOAHZK_variable_width_grow(quot, width0 + 1);
+        quot->width = width0 + 1;
+        NOAHZK_variable_width_div_store(quot, q, width_q, sign0 ^ sign1);
+        NOAHZK_variable_width_auto_trim(quot);
+    }
+    if(rem){
+        NOAHZK_variable_width_grow(rem, width1 + 1);
+        rem->width = width1 + 1;
+        NOAHZK_variable_width_div_store(rem, r, width_r, sign0);
+        NOAHZK_variable_width_auto_trim(rem);
+    }
+
+    NOAHZK_temporary_free(abs_rs0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+    return 1;
+}
+
+// Barrett reduction, for reducing many values by the same modulus N, k limbs wide: with mu = floor(B^2k/N) precomputed,
+// the quotient of x < B^2k is estimated by (floor(x/B^(k-1))*mu)/B^(k+1), which is at most 2 short, so reducing takes
+// two multiplications & two conditional subtractions. N has to be positive; reducing is constant-time, setting up a context isn't.
+
+typedef struct{
+    size_t width;                       // k, the width of N in limbs
+    NOAHZK_variable_width_t modulus;    // N
+    NOAHZK_variable_width_t mu;         // floor(B^2k/N), k + 2 limbs wide
+} NOAHZK_barrett_ctx_t;
+
+// not constant-time
+// initialises ctx for the modulus passed, or returns ptr to a new context if NULL is passed for it.
+// the modulus has to be greater than 0; returns NULL otherwise.
+void* NOAHZK_barrett_ctx_init(NOAHZK_barrett_ctx_t* ctx, const NOAHZK_variable_width_t* const modulus){
+    size_t width = modulus->width;
+    while(width && !modulus->arr[width - 1]) width--;
+    if(!width || modulus->sign) return NULL;
+
+    if(!ctx) ctx = NOAHZK_malloc(sizeof(NOAHZK_barrett_ctx_t));
+
+    ctx->width = width;
+    NOAHZK_variable_width_init_arr(&ctx->modulus, modulus->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    NOAHZK_variable_width_init(&ctx->mu, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width + 2));
+
+// B^2k is 2k + 1 limbs wide, so the quotient is k + 2
+    const size_t width_power = 2*width + 1, width_scratch = width_power + width + width_power + width + 1;
+    NOAHZK_limb_t* const power = NOAHZK_temporary_malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+    NOAHZK_limb_t* const r = power + width_power, *const scratch = r + width;
+    memset(power, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_power));
+    power[2*width] = 1;
+    NOAHZK_variable_width_divrem_vartime_primitive(ctx->mu.arr, r, power, ctx->modulus.arr, width_power, width, scratch);
+    NOAHZK_temporary_free(power, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+
+    return ctx;
+}
+
+void NOAHZK_barrett_ctx_destroy(NOAHZK_barrett_ctx_t* const todestroy, const NOAHZK_variable_width_option_t freeptr){
+    NOAHZK_variable_width_destroy(&todestroy->modulus, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&todestroy->mu, NOAHZK_variable_width_keep_ptr);
+    todestroy->width = 0;
+
+    if(freeptr == NOAHZK_variable_width_free_ptr) NOAHZK_free(todestroy, sizeof(NOAHZK_barrett_ctx_t));
+}
+
+// limbs of scratch NOAHZK_variable_width_barrett_reduce_scratch needs: x, q, q*N, r & r - N, then the multiplications' scratch
+size_t NOAHZK_variable_width_barrett_reduce_scratch_size(const NOAHZK_barrett_ctx_t* const ctx){
+    const size_t k = ctx->width;
+    return 2*k + (2*k + 3) + 3*(k + 1) + NOAHZK_MAX(NOAHZK_variable_width_mul_limb_scratch_size(k + 1, k + 2), NOAHZK_variable_width_mul_limb_scratch_size(k + 1, k));
+}
+
+// dst = src mod N, for unsigned src up to 2k limbs wide (wider ones are read up to 2k limbs).
+// dst has to be at least k limbs wide; the result is written to its lowest k limbs & the rest is cleared. dst may alias src.
+// scratch has to be NOAHZK_variable_width_barrett_reduce_scratch_size(ctx) limbs wide, so reducing many values by the same N can reuse it
+// & never allocates. constant-time
+void NOAHZK_variable_width_barrett_reduce_scratch(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const NOAHZK_barrett_ctx_t* const ctx, NOAHZK_limb_t* const scratch){
+    const size_t k = ctx->width;
+    NOAHZK_limb_t* const x = scratch;
+    NOAHZK_limb_t* const q = x + 2*k, *const qn = q + 2*k + 3, *const r = qn + k + 1, *const difference = r + k + 1, *const scratch_mul = difference + k + 1;
+    for(size_t i = 0; i < 2*k; i++) x[i] = NOAHZK_variable_width_get_arr(src->arr, src->width, 0, i);
+
+// q = floor(floor(x/B^(k-1))*mu/B^(k+1)), which is below B^(k+1); r = x - q*N mod B^(k+1), which is below 3N
+    NOAHZK_variable_width_mul_limb_scratch(q, x + k - 1, ctx->mu.arr, k + 1, k + 2, 2*k + 3, scratch_mul);
+    NOAHZK_variable_width_mul_limb_scratch(qn, q + k + 1, ctx->modulus.arr, k + 1, k, k + 1, scratch_mul);
+    NOAHZK_variable_width_sub_primitive(r, x, qn, k + 1, k + 1, k + 1, 0, 0);
+
+    for(size_t i = 0; i < 2; i++){
+        const NOAHZK_limb_t no_borrow = NOAHZK_variable_width_sub_primitive(difference, r, ctx->modulus.arr, k + 1, k + 1, k, 0, 0);
+        const NOAHZK_limb_t mask = -no_borrow;
+        for(size_t j = 0; j < k + 1; j++) r[j] = (difference[j] & mask) | (r[j] & ~mask);
+    }
+
+    memcpy(dst->arr, r, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(k));
+    memset(dst->arr + k, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(dst->width - k));
+    dst->sign = 0;
+    NOAHZK_variable_width_drop_bitcnt(dst);
+}
+
+// same as above, with scratch from the default workspace
+void NOAHZK_variable_width_barrett_reduce(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const NOAHZK_barrett_ctx_t* const ctx){
+    NOAHZK_variable_width_barrett_reduce_scratch(dst, src, ctx, NOAHZK_default_workspace_get(NOAHZK_variable_width_barrett_reduce_scratch_size(ctx)));
+}
+
+#endif
@@ -0,0 +1,219 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+#ifndef NOAHZK_bigint_dot_included
+#define NOAHZK_bigint_dot_included
+
+#include "definitions.h"    // NOAHZK variable-width type
+#include "logarithms.h"     // NOAHZK_min_bitcnt_var
+#include "type.h"           // ops to allocate, destroy variable width types
+#include "cpu.h"            // add_n kernel picked for this cpu
+#include "mul.h"            // NOAHZK_variable_width_mul_dispatch_scratch, NOAHZK_variable_width_addmul_arr_with_limb
+#include "montgomery.h"     // NOAHZK_montgomery_ctx_t, Montgomery reduction
+#include "workspace.h"      // scratch for the accumulated sum
+#include "stdint.h"         // integer types
+#include "string.h"         // memset, memcpy
+
+// dot products, or multiply-accumulate over many terms: dst = rs0[0]*rs1[0] + ... + rs0[count-1]*rs1[count-1].
+// every product is computed into scratch by the multiplication tiers & added into one accumulator, but the limb carried out of
+// the top of each addition isn't propagated: it's added to a two-limb counter for its column instead, & the counters are only carried through once,
+// after the last term. so nothing is allocated per term & no carry ripples through the rest of the accumulator per term.
+// the modular forms reduce the whole sum once, at the end, instead of every product. count has to be below 2^(BITS_IN_NOAHZK_LIMB - 1).
+
+// counter[index] += x, where counter is a two-limb counter per column split into its low & high limbs
+void NOAHZK_variable_width_dot_count(NOAHZK_limb_t* const lo, NOAHZK_limb_t* const hi, const size_t index, const NOAHZK_limb_t x){
+    lo[index] += x;
+    hi[index] += lo[index] < x;
+}
+
+// limbs of scratch NOAHZK_variable_width_dot_primitive needs: the column counters, then room for the widest product & its multiplication's scratch
+size_t NOAHZK_variable_width_dot_primitive_scratch_size(const NOAHZK_variable_width_t* const* const rs0, const NOAHZK_variable_width_t* const* const rs1, const size_t count, const size_t width_dst, const size_t width_max){
+    size_t width_product = 0, width_mul = 0;
+    for(size_t t = 0; t < count; t++){
+        const size_t width0 = NOAHZK_MIN(rs0[t]->width, width_max), width1 = NOAHZK_MIN(rs1[t]->width, width_max);
+        width_product = NOAHZK_MAX(width_product, width0 + width1);
+        width_mul = NOAHZK_MAX(width_mul, NOAHZK_variable_width_mul_dispatch_scratch_size(width0, width1));
+    }
+    return 4*width_dst + width_product + width_mul;
+}
+
+// dst = rs0[0]*rs1[0] + ... + rs0[count-1]*rs1[count-1] mod B^width_dst, where every operand is read up to width_max limbs.
+// is_signed is 1 for two's complement operands, 0 to read all of them as unsigned.
+// two's complement operands go in as they are, like in NOAHZK_variable_width_mul_signed_fixup_primitive:
+// x*y = u0*u1 - sign0*u1*B^width0 - sign1*u0*B^width1 + sign0*sign1*B^(width0 + width1), so the corrections are counted per column too,
+// & subtracted as the counters are carried through.
+// dst may not alias any source. scratch has to be NOAHZK_variable_width_dot_primitive_scratch_size(rs0, rs1, count, width_dst, width_max) limbs wide.
+// constant-time, as long as the widths & count are.
+void NOAHZK_variable_width_dot_primitive(NOAHZK_limb_t* const restrict dst, const NOAHZK_variable_width_t* const* const rs0, const NOAHZK_variable_width_t* const* const rs1, const size_t count, const size_t width_dst, const size_t width_max, NOAHZK_op_t is_signed, NOAHZK_limb_t* const scratch){
+    NOAHZK_limb_t* const carry_lo = scratch, *const carry_hi = scratch + width_dst, *const neg_lo = scratch + 2*width_dst, *const neg_hi = scratch + 3*width_dst;
+    NOAHZK_limb_t* const product = scratch + 4*width_dst;
+    memset(dst, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_dst));
+    memset(scratch, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(4*width_dst));
+
+    for(size_t t = 0; t < count; t++){
+        const NOAHZK_limb_t* const a = rs0[t]->arr, *const b = rs1[t]->arr;
+        const size_t width0 = NOAHZK_MIN(rs0[t]->width, width_max), width1 = NOAHZK_MIN(rs1[t]->width, width_max);
+        if(!width0 || !width1) continue;
+        const NOAHZK_limb_t mask0 = -(rs0[t]->sign & is_signed), mask1 = -(rs1[t]->sign & is_signed);
+
+        NOAHZK_variable_width_mul_dispatch_scratch(product, a, b, width0, width1, product + width0 + width1);
+        const size_t width_add = NOAHZK_MIN(width0 + width1, width_dst);
+        const NOAHZK_limb_t carry = NOAHZK_kernels.add_n(dst, dst, product, width_add);
+        if(width_add < width_dst) NOAHZK_variable_width_dot_count(carry_lo, carry_hi, width_add, carry);
+
+        for(size_t i = 0; i < width1 && width0 + i < width_dst; i++) NOAHZK_variable_width_dot_count(neg_lo, neg_hi, width0 + i, b[i] & mask0);
+        for(size_t i = 0; i < width0 && width1 + i < width_dst; i++) NOAHZK_variable_width_dot_count(neg_lo, neg_hi, width1 + i, a[i] & mask1);
+        if(width0 + width1 < width_dst) NOAHZK_variable_width_dot_count(carry_lo, carry_hi, width0 + width1, mask0 & mask1 & 1);
+    }
+
+// the counters' high limbs belong to the next column, so they're carried in with whatever the column itself carries out
+    NOAHZK_expanded_limb_t sum = 0, neg = 0;
+    NOAHZK_limb_t carry = 1;
+    for(size_t c = 0; c < width_dst; c++){
+        sum += (NOAHZK_expanded_limb_t)dst[c] + carry_lo[c];
+        neg += neg_lo[c];
+// subtracts the corrections' limb by adding its complement, the same as sub_primitive
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)(NOAHZK_limb_t)sum + (NOAHZK_limb_t)~(NOAHZK_limb_t)neg + carry;
+        dst[c] = z & NOAHZK_LIMB_MAX;
+        carry = NOAHZK_variable_width_get_out(z);
+        sum = (sum >> BITS_IN_NOAHZK_LIMB) + carry_hi[c];
+        neg = (neg >> BITS_IN_NOAHZK_LIMB) + neg_hi[c];
+    }
+}
+
+// plain dot products
+
+// limbs of scratch NOAHZK_variable_width_dot_scratch needs for a dst width_dst limbs wide
+size_t NOAHZK_variable_width_dot_scratch_size(const NOAHZK_variable_width_t* const* const rs0, const NOAHZK_variable_width_t* const* const rs1, const size_t count, const size_t width_dst){
+    return width_dst + NOAHZK_variable_width_dot_primitive_scratch_size(rs0, rs1, count, width_dst, SIZE_MAX);
+}
+
+// dst = rs0[0]*rs1[0] + ... + rs0[count-1]*rs1[count-1], truncated or sign-extended to dst's width, like NOAHZK_variable_width_mul.
+// dst may alias any source. scratch has to be NOAHZK_variable_width_dot_scratch_size(rs0, rs1, count, dst->width) limbs wide. constant-time
+void NOAHZK_variable_width_dot_scratch(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const* const rs0, const NOAHZK_variable_width_t* const* const rs1, const size_t count, NOAHZK_limb_t* const scratch){
+    if(!dst->width) return;
+    NOAHZK_variable_width_dot_primitive(scratch, rs0, rs1, count, dst->width, SIZE_MAX, 1, scratch + dst->width);
+// HAS to be copied at the end, as dst may alias any source
+    memcpy(dst->arr, scratch, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(dst));
+    dst->sign = NOAHZK_variable_width_get_sign(dst);
+    NOAHZK_variable_width_drop_bitcnt(dst);
+}
+
+void NOAHZK_variable_width_dot(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const* const rs0, const NOAHZK_variable_width_t* const* const rs1, const size_t count){
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_dot_scratch_size(rs0, rs1, count, dst->width));
+    NOAHZK_variable_width_dot_scratch(dst, rs0, rs1, count, scratch);
+}
+
+// dst = rs0[0]*rs1[0] + ... + rs0[count-1]*rs1[count-1]; resizes dst to the widest product plus enough limbs to count the terms in, so the sum always fits.
+// replaces count calls to NOAHZK_variable_width_madd_and_resize, without their temporaries & reallocations.
+void NOAHZK_variable_width_dot_and_resize(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const* const rs0, const NOAHZK_variable_width_t* const* const rs1, const size_t count){
+    size_t width_product = 0;
+    for(size_t t = 0; t < count; t++) width_product = NOAHZK_MAX(width_product, rs0[t]->width + rs1[t]->width);
+    const size_t new_width = width_product + NOAHZK_SIZE_AS_ARR_OF_TYPE(NOAHZK_min_bitcnt_var(count), BITS_IN_NOAHZK_LIMB);
+// an empty sum is 0, which takes up no limbs, like a 0 from NOAHZK_variable_width_init_and_resize_unsigned_constant
+    if(!new_width){
+        dst->width = 0;
+        dst->sign = 0;
+        NOAHZK_variable_width_drop_bitcnt(dst);
+        return;
+    }
+
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_dot_scratch_size(rs0, rs1, count, new_width));
+    NOAHZK_variable_width_dot_primitive(scratch, rs0, rs1, count, new_width, SIZE_MAX, 1, scratch + new_width);
+// dst is only resized once the sum is done, as it may alias any source
+    NOAHZK_variable_width_grow(dst, new_width);
+    memcpy(dst->arr, scratch, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(new_width));
+    dst->width = new_width;
+    dst->sign = NOAHZK_variable_width_get_sign(dst);
+    NOAHZK_variable_width_drop_bitcnt(dst);
+    NOAHZK_variable_width_auto_trim(dst);
+}
+
+// modular dot products
+// operands are residues of ctx (so below N), read as in montgomery.h: zero-extended or truncated to ctx->width limbs, & unsigned.
+// dst has to be at least ctx->width limbs wide; the result is written to its lowest ctx->width limbs & the rest is cleared.
+
+// sets dst to B*R mod N, where B = 2^BITS_IN_NOAHZK_LIMB: R^2*B reduced once. R^2*B < N*B <= N*R, so it's a valid input.
+// scratch is 2*ctx->width limbs wide.
+void NOAHZK_variable_width_mont_dot_correction(NOAHZK_limb_t* const dst, const NOAHZK_montgomery_ctx_t* const ctx, NOAHZK_limb_t* const scratch){
+    const size_t width = ctx->width;
+    NOAHZK_limb_t* const t = scratch;
+    memset(t, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(2*width));
+    memcpy(t + 1, ctx->r2.arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    NOAHZK_variable_width_mont_redc_primitive(dst, t, ctx->modulus.arr, ctx->n0_inv_neg, width);
+}
+
+// limbs of scratch NOAHZK_variable_width_mont_dot_reduce needs: the sum, then the column counters & products of NOAHZK_variable_width_dot_primitive
+size_t NOAHZK_variable_width_mont_dot_reduce_scratch_size(const NOAHZK_variable_width_t* const* const rs0, const NOAHZK_variable_width_t* const* const rs1, const size_t count, const NOAHZK_montgomery_ctx_t* const ctx){
+    const size_t width = ctx->width;
+    return 2*width + 1 + NOAHZK_variable_width_dot_primitive_scratch_size(rs0, rs1, count, 2*width + 1, width);
+}
+
+// dst = (rs0[0]*rs1[0] + ... + rs0[count-1]*rs1[count-1])*(R*B)^-1 mod N.
+// the sum T is below count*N^2 < N*R*B, so reducing it by R*B instead of R, with one more Montgomery step, leaves it below 2N
+// & a single conditional subtraction finishes it off. scratch has to be NOAHZK_variable_width_mont_dot_reduce_scratch_size(rs0, rs1, count, ctx) limbs wide.
+// constant-time
+void NOAHZK_variable_width_mont_dot_reduce(NOAHZK_limb_t* const dst, const NOAHZK_variable_width_t* const* const rs0, const NOAHZK_variable_width_t* const* const rs1, const size_t count, const NOAHZK_montgomery_ctx_t* const ctx, NOAHZK_limb_t* const scratch){
+    const size_t width = ctx->width;
+    NOAHZK_limb_t* const t = scratch;
+    NOAHZK_variable_width_dot_primitive(t, rs0, rs1, count, 2*width + 1, width, 0, t + 2*width + 1);
+
+    NOAHZK_limb_t top = 0;
+    for(size_t i = 0; i <= width; i++){
+        const NOAHZK_limb_t m = t[i] * ctx->n0_inv_neg;
+        const NOAHZK_limb_t carry = NOAHZK_variable_width_addmul_arr_with_limb(t + i, ctx->modulus.arr, m, width);
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)t[i + width] + carry + top;
+        t[i + width] = z & NOAHZK_LIMB_MAX;
+        top = NOAHZK_variable_width_get_out(z);
+    }
+
+    NOAHZK_variable_width_mont_reduce_once_primitive(dst, t + width + 1, top, ctx->modulus.arr, width);
+}
+
+// limbs of scratch NOAHZK_variable_width_mont_dot_scratch & NOAHZK_variable_width_dot_mod_scratch need: the reduced sum & the correction,
+// then room for the reduction, or for the Montgomery multiplications after it
+size_t NOAHZK_variable_width_mont_dot_scratch_size(const NOAHZK_variable_width_t* const* const rs0, const NOAHZK_variable_width_t* const* const rs1, const size_t count, const NOAHZK_montgomery_ctx_t* const ctx){
+    const size_t width = ctx->width;
+    return 2*width + NOAHZK_MAX(NOAHZK_variable_width_mont_dot_reduce_scratch_size(rs0, rs1, count, ctx), NOAHZK_variable_width_mont_mul_primitive_scratch_size(width));
+}
+
+// dst = (rs0[0]*rs1[0] + ... + rs0[count-1]*rs1[count-1])*R^-1 mod N; the Montgomery form of the dot product, if every operand is in Montgomery form.
+// costs count multiplications, but only one reduction & one Montgomery multiplication. dst may alias any source.
+// scratch has to be NOAHZK_variable_width_mont_dot_scratch_size(rs0, rs1, count, ctx) limbs wide. constant-time
+void NOAHZK_variable_width_mont_dot_scratch(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const* const rs0, const NOAHZK_variable_width_t* const* const rs1, const size_t count, const NOAHZK_montgomery_ctx_t* const ctx, NOAHZK_limb_t* const scratch){
+    NOAHZK_limb_t* const sum = scratch, *const correction = scratch + ctx->width, *const rest = scratch + 2*ctx->width;
+    NOAHZK_variable_width_mont_dot_reduce(sum, rs0, rs1, count, ctx, rest);
+// (T*(R*B)^-1)*(B*R)*R^-1 = T*R^-1
+    NOAHZK_variable_width_mont_dot_correction(correction, ctx, rest);
+    NOAHZK_variable_width_mont_mul_primitive_scratch(dst->arr, sum, correction, ctx->modulus.arr, ctx->n0_inv_neg, ctx->width, rest);
+    NOAHZK_variable_width_mont_finish(dst, ctx);
+}
+
+void NOAHZK_variable_width_mont_dot(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const* const rs0, const NOAHZK_variable_width_t* const* const rs1, const size_t count, const NOAHZK_montgomery_ctx_t* const ctx){
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_mont_dot_scratch_size(rs0, rs1, count, ctx));
+    NOAHZK_variable_width_mont_dot_scratch(dst, rs0, rs1, count, ctx, scratch);
+}
+
+// dst = rs0[0]*rs1[0] + ... + rs0[count-1]*rs1[count-1] mod N, for operands out of Montgomery form.
+// dst may alias any source. scratch has to be NOAHZK_variable_width_mont_dot_scratch_size(rs0, rs1, count, ctx) limbs wide. constant-time
+void NOAHZK_variable_width_dot_mod_scratch(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const* const rs0, const NOAHZK_variable_width_t* const* const rs1, const size_t count, const NOAHZK_montgomery_ctx_t* const ctx, NOAHZK_limb_t* const scratch){
+    NOAHZK_limb_t* const sum = scratch, *const correction = scratch + ctx->width, *const rest = scratch + 2*ctx->width;
+    NOAHZK_variable_width_mont_dot_reduce(sum, rs0, rs1, count, ctx, rest);
+// (B*R)*R^2*R^-1 = B*R^2, & (T*(R*B)^-1)*(B*R^2)*R^-1 = T
+    NOAHZK_variable_width_mont_dot_correction(correction, ctx, rest);
+    NOAHZK_variable_width_mont_mul_primitive_scratch(correction, correction, ctx->r2.arr, ctx->modulus.arr, ctx->n0_inv_neg, ctx->width, rest);
+    NOAHZK_variable_width_mont_mul_primitive_scratch(dst->arr, sum, correction, ctx->modulus.arr, ctx->n0_inv_neg, ctx->width, rest);
+    NOAHZK_variable_width_mont_finish(dst, ctx);
+}
+
+void NOAHZK_variable_width_dot_mod(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const* const rs0, const NOAHZK_variable_width_t* const* const rs1, const size_t count, const NOAHZK_montgomery_ctx_t* const ctx){
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_mont_dot_scratch_size(rs0, rs1, count, ctx));
+    NOAHZK_variable_width_dot_mod_scratch(dst, rs0, rs1, count, ctx, scratch);
+}
+
+#endif
@@ -0,0 +1,125 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+#ifndef NOAHZK_bigint_fixed_width_included
+#define NOAHZK_bigint_fixed_width_included
+
+#include "definitions.h"    // NOAHZK variable-width type
+#include "type.h"           // NOAHZK_variable_width_init
+#include "stdint.h"         // integer types
+#include "string.h"         // memcpy
+
+// fixed-width integers, for when the width is known at compile time (i.e. field elements).
+// they're plain structs holding an array of limbs, so they can live on the stack or inside other structs & never allocate.
+// all of them are two's complement without a separate sign field, & every op is constant-time.
+// NOAHZK_FIXED_WIDTH_DEFINE(bits) generates the type NOAHZK_fixed_width_<bits>_t & the NOAHZK_fixed_width_<bits>_<op> family for it;
+// 256 & 384-bit are defined below, any other multiple of BITS_IN_NOAHZK_LIMB can be defined the same way.
+
+// asks the compiler to fully unroll the loop following it. all loops over fixed-width types have constant bounds, so they all can be.
+#if defined(__clang__)
+#define NOAHZK_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__)
+#define NOAHZK_UNROLL _Pragma("GCC unroll 64")
+#else
+#define NOAHZK_UNROLL
+#endif
+
+#define NOAHZK_FIXED_WIDTH_LIMBS(bits) ((bits)/BITS_IN_NOAHZK_LIMB)
+
+#define NOAHZK_FIXED_WIDTH_DEFINE(bits)                                                                                                                                                 \
+typedef struct{                                                                                                                                                                         \
+    NOAHZK_limb_t arr[NOAHZK_FIXED_WIDTH_LIMBS(bits)];                                                                                                                                  \
+} NOAHZK_fixed_width_##bits##_t;                                                                                                                                                        \
+                                                                                                                                                                                        \
+/* dst = rs0 + rs1, returns carry */                                                                                                                                                    \
+NOAHZK_limb_t NOAHZK_fixed_width_##bits##_add(NOAHZK_fixed_width_##bits##_t* const dst, const NOAHZK_fixed_width_##bits##_t* const rs0, const NOAHZK_fixed_width_##bits##_t* const rs1){ \
+    NOAHZK_limb_t carry = 0;                                                                                                                                                            \
+    NOAHZK_UNROLL                                                                                                                                                                       \
+    for(size_t i = 0; i < NOAHZK_FIXED_WIDTH_LIMBS(bits); i++){                                                                                                                         \
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)rs0->arr[i] + rs1->arr[i] + carry;                                                                                     \
+        dst->arr[i] = z & NOAHZK_LIMB_MAX;                                                                                                                                              \
+        carry = NOAHZK_variable_width_get_out(z);                                                                                                                                       \
+    }                                                                                                                                                                                   \
+    return carry;                                                                                                                                                                       \
+}                                                                                                                                                                                       \
+                                                                                                                                                                                        \
+/* dst = rs0 - rs1, returns carry (1 if there's no borrow), the same as NOAHZK_variable_width_sub_primitive */                                                                          \
+NOAHZK_limb_t NOAHZK_fixed_width_##bits##_sub(NOAHZK_fixed_width_##bits##_t* const dst, const NOAHZK_fixed_width_##bits##_t* const rs0, const NOAHZK_fixed_width_##bits##_t* const rs1){ \
+    NOAHZK_limb_t carry = 1;                                                                                                                                                            \
+    NOAHZK_UNROLL                                                                                                                                                                       \
+    for(size_t i = 0; i < NOAHZK_FIXED_WIDTH_LIMBS(bits); i++){                                                                                                                         \
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)rs0->arr[i] + (NOAHZK_limb_t)~rs1->arr[i] + carry;                                                                    \
+        dst->arr[i] = z & NOAHZK_LIMB_MAX;                                                                                                                                              \
+        carry = NOAHZK_variable_width_get_out(z);                                                                                                                                       \
+    }                                                                                                                                                                                   \
+    return carry;                                                                                                                                                                       \
+}                                                                                                                                                                                       \
+                                                                                                                                                                                        \
+/* dst = ~src */                                                                                                                                                                        \
+void NOAHZK_fixed_width_##bits##_invert(NOAHZK_fixed_width_##bits##_t* const dst, const NOAHZK_fixed_width_##bits##_t* const src){                                                     \
+    NOAHZK_UNROLL                                                                                                                                                                       \
+    for(size_t i = 0; i < NOAHZK_FIXED_WIDTH_LIMBS(bits); i++) dst->arr[i] = ~src->arr[i];                                                                                              \
+}                                                                                                                                                                                       \
+                                                                                                                                                                                        \
+/* dst = rs0*rs1, the full (unsigned) product; dst is 2*NOAHZK_FIXED_WIDTH_LIMBS(bits) limbs wide */                                                                                    \
+void NOAHZK_fixed_width_##bits##_mul_wide(NOAHZK_limb_t* const dst, const NOAHZK_fixed_width_##bits##_t* const rs0, const NOAHZK_fixed_width_##bits##_t* const rs1){                  \
+    NOAHZK_limb_t t[2*NOAHZK_FIXED_WIDTH_LIMBS(bits)];                                                                                                                                  \
+    NOAHZK_UNROLL                                                                                                                                                                       \
+    for(size_t i = 0; i < NOAHZK_FIXED_WIDTH_LIMBS(bits); i++){                                                                                                                         \
+        NOAHZK_limb_t carry = 0;                                                                                                                                                        \
+        NOAHZK_UNROLL                                                                                                                                                                   \
+        for(size_t j = 0; j < NOAHZK_FIXED_WIDTH_LIMBS(bits); j++){                                                                                                                     \
+            const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)rs0->arr[j]*rs1->arr[i] + (i? t[i + j]: 0) + carry;                                                                \
+            t[i + j] = z & NOAHZK_LIMB_MAX;                                                                                                                                             \
+            carry = z >> BITS_IN_NOAHZK_LIMB;                                                                                                                                           \
+        }                                                                                                                                                                               \
+        t[i + NOAHZK_FIXED_WIDTH_LIMBS(bits)] = carry;                                                                                                                                  \
+    }                                                                                                                                                                                   \
+    memcpy(dst, t, sizeof(t));                                                                                                                                                          \
+}                                                                                                                                                                                       \
+                                                                                                                                                                                        \
+/* dst = rs0*rs1 mod 2^bits; the same for signed & unsigned operands */                                                                                                                \
+void NOAHZK_fixed_width_##bits##_mul(NOAHZK_fixed_width_##bits##_t* const dst, const NOAHZK_fixed_width_##bits##_t* const rs0, const NOAHZK_fixed_width_##bits##_t* const rs1){       \
+    NOAHZK_limb_t t[NOAHZK_FIXED_WIDTH_LIMBS(bits)] = {0};                                                                                                                              \
+    NOAHZK_UNROLL                                                                                                                                                                       \
+    for(size_t i = 0; i < NOAHZK_FIXED_WIDTH_LIMBS(bits); i++){                                                                                                                         \
+        NOAHZK_limb_t carry = 0;                                                                                                                                                        \
+        NOAHZK_UNROLL                                                                                                                                                                   \
+        for(size_t j = 0; j + i < NOAHZK_FIXED_WIDTH_LIMBS(bits); j++){                                                                                                                 \
+            const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)rs0->arr[j]*rs1->arr[i] + t[i + j] + carry;                                                                        \
+            t[i + j] = z & NOAHZK_LIMB_MAX;                                                                                                                                             \
+            carry = z >> BITS_IN_NOAHZK_LIMB;                                                                                                                                           \
+        }                                                                                                                                                                               \
+    }                                                                                                                                                                                   \
+    memcpy(dst->arr, t, sizeof(t));                                                                                                                                                     \
+}                                                                                                                                                                                       \
+                                                                                                                                                                                        \
+/* dst = src, truncated or sign-extended to bits. constant-time as long as src->width is constant */                                                                                   \
+void NOAHZK_fixed_width_##bits##_from_variable_width(NOAHZK_fixed_width_##bits##_t* const dst, const NOAHZK_variable_width_t* const src){                                              \
+    for(size_t i = 0; i < NOAHZK_FIXED_WIDTH_LIMBS(bits); i++) dst->arr[i] = NOAHZK_variable_width_get_arr(src->arr, src->width, src->sign, i);                                        \
+}                                                                                                                                                                                       \
+                                                                                                                                                                                        \
+/* dst = src, read as signed (sign-extended to dst's width) if is_signed, otherwise as unsigned (zero-extended). dst keeps its width */                                                 \
+void NOAHZK_fixed_width_##bits##_to_variable_width(NOAHZK_variable_width_t* const dst, const NOAHZK_fixed_width_##bits##_t* const src, const NOAHZK_op_t is_signed){                    \
+    const NOAHZK_limb_t sign = (src->arr[NOAHZK_FIXED_WIDTH_LIMBS(bits) - 1] >> (BITS_IN_NOAHZK_LIMB - 1)) & is_signed;                                                                \
+    for(size_t i = 0; i < dst->width; i++) dst->arr[i] = NOAHZK_variable_width_get_arr(src->arr, NOAHZK_FIXED_WIDTH_LIMBS(bits), sign, i);                                              \
+    dst->sign = dst->width? NOAHZK_variable_width_get_sign(dst): 0;                                                                                                                     \
+    NOAHZK_variable_width_drop_bitcnt(dst);                                                                                                                                             \
+}                                                                                                                                                                                       \
+                                                                                                                                                                                        \
+/* same as above, but grows dst to bits first if it's narrower */                                                                                                                       \
+void NOAHZK_fixed_width_##bits##_to_variable_width_and_resize(NOAHZK_variable_width_t* const dst, const NOAHZK_fixed_width_##bits##_t* const src, const NOAHZK_op_t is_signed){         \
+    NOAHZK_variable_width_resize_to_largest(dst, dst->width, NOAHZK_FIXED_WIDTH_LIMBS(bits));                                                                                           \
+    NOAHZK_fixed_width_##bits##_to_variable_width(dst, src, is_signed);                                                                                                                 \
+    NOAHZK_variable_width_auto_trim(dst);                                                                                                                                               \
+}
+
+NOAHZK_FIXED_WIDTH_DEFINE(256)
+NOAHZK_FIXED_WIDTH_DEFINE(384)
+
+#endif
@@ -32,29 +32,94 @@ size_t NOAHZK_ceil_log2_value(const uint64_t value){
     return NOAHZK_min_bitcnt_var(value-1) & ~is_value_0_flag;
 }
 
-size_t NOAHZK_variable_width_min_bitcnt_byte(const void* const real_value, size_t size){
-    size_t number_of_leading_zeroes = 0;
-    uint8_t flag = 0;
-
+// runs in constant time as long as size does
+// number of significant bits in the size bytes at real_value, read as an unsigned little-endian number. like the limb version below,
+// the bit count of the topmost nonzero byte is kept with a mask instead of a branch.
+size_t NOAHZK_variable_width_min_bitcnt_byte(const void* const real_value, const size_t size){
     const uint8_t* const value = real_value;
+    size_t bitcnt = 0;
 
-// exploits unsigned integer overflow so it iterates from top bit to last one
-    for(size_t i = size - 1; i < size; i--){
-        uint8_t number_of_0_bits = __builtin_popcountll(~value[i]);
-        uint8_t is_value_0 = (number_of_0_bits - BITS_IN_UINT64_T + 1) & 1 & ~((number_of_0_bits - BITS_IN_UINT64_T) >> (BITS_IN_UINT8_T - 1));
-
-        uint8_t this_byte_number_of_leading_zeroes = __builtin_clzll(value[i] | flag | is_value_0) - (BITS_IN_UINT64_T - BITS_IN_UINT8_T);
-        uint8_t is_value_all_zeroes = BITS_IN_UINT8_T - this_byte_number_of_leading_zeroes;
-        flag |= (uint16_t)(is_value_all_zeroes - is_value_0) << (__builtin_clzll(is_value_all_zeroes) - (BITS_IN_UINT64_T - BITS_IN_UINT8_T));
+    for(size_t i = 0; i < size; i++){
+        const size_t is_nonzero = -(size_t)((uint8_t)(value[i] | -value[i]) >> (BITS_IN_UINT8_T - 1));
+        bitcnt ^= (bitcnt ^ (i*BITS_IN_UINT8_T + NOAHZK_min_bitcnt_var(value[i]))) & is_nonzero;
+    }
+    return bitcnt;
+}
 
-        number_of_leading_zeroes += this_byte_number_of_leading_zeroes + is_value_0;
+// bit lengths of limb arrays, a limb at a time. the signed ones give the minimum two's complement width, sign bit included, so 0 & -1 are
+// both 1 bit wide; a negative value is as wide as its complement, so the limbs are XORed with the sign mask on the way in & nothing is negated.
+
+// runs in constant time as long as width does
+// number of significant bits in src (width limbs), read as unsigned, with the limbs XORed with mask. every limb is looked at,
+// & the bit count of the topmost nonzero one is kept with a mask instead of a branch.
+size_t NOAHZK_variable_width_bitcnt_masked_primitive(const NOAHZK_limb_t* const src, const size_t width, const NOAHZK_limb_t mask){
+    size_t bitcnt = 0;
+    for(size_t i = 0; i < width; i++){
+        const NOAHZK_limb_t limb = src[i] ^ mask;
+        const size_t is_nonzero = -(size_t)((NOAHZK_limb_t)(limb | -limb) >> (BITS_IN_NOAHZK_LIMB - 1));
+        bitcnt ^= (bitcnt ^ (i*BITS_IN_NOAHZK_LIMB + NOAHZK_min_bitcnt_var(limb))) & is_nonzero;
     }
+    return bitcnt;
+}
+
+// runs in constant time as long as width does
+size_t NOAHZK_variable_width_bitcnt_primitive(const NOAHZK_limb_t* const src, const size_t width){
+    return NOAHZK_variable_width_bitcnt_masked_primitive(src, width, 0);
+}
+
+// runs in constant time as long as width does
+// two's complement width of src, whose sign is sign, in bits.
+size_t NOAHZK_variable_width_signed_bitcnt_primitive(const NOAHZK_limb_t* const src, const size_t width, const NOAHZK_limb_t sign){
+    return NOAHZK_variable_width_bitcnt_masked_primitive(src, width, -sign) + 1;
+}
+
+// not constant-time; for public values only. scans down from the top limb & stops at the first that isn't just mask.
+size_t NOAHZK_variable_width_bitcnt_masked_vartime_primitive(const NOAHZK_limb_t* const src, size_t width, const NOAHZK_limb_t mask){
+    while(width && src[width - 1] == mask) width--;
+    return width? (width - 1)*BITS_IN_NOAHZK_LIMB + NOAHZK_min_bitcnt_var(src[width - 1] ^ mask): 0;
+}
 
-    return size*BITS_IN_UINT8_T - number_of_leading_zeroes;
+// not constant-time
+size_t NOAHZK_variable_width_bitcnt_vartime_primitive(const NOAHZK_limb_t* const src, const size_t width){
+    return NOAHZK_variable_width_bitcnt_masked_vartime_primitive(src, width, 0);
 }
 
+// not constant-time
+size_t NOAHZK_variable_width_signed_bitcnt_vartime_primitive(const NOAHZK_limb_t* const src, const size_t width, const NOAHZK_limb_t sign){
+    return NOAHZK_variable_width_bitcnt_masked_vartime_primitive(src, width, -sign) + 1;
+}
+
+// runs in constant time as long as value->width does
+// number of significant bits in value, read as unsigned
 size_t NOAHZK_variable_width_min_bitcnt(const NOAHZK_variable_width_t* const value){
-    return NOAHZK_variable_width_min_bitcnt_byte(value->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(value));
+    return NOAHZK_variable_width_bitcnt_primitive(value->arr, value->width);
+}
+
+// not constant-time
+size_t NOAHZK_variable_width_min_bitcnt_vartime(const NOAHZK_variable_width_t* const value){
+    return NOAHZK_variable_width_bitcnt_vartime_primitive(value->arr, value->width);
+}
+
+// runs in constant time as long as value->width does
+// two's complement width of value in bits, sign bit included
+size_t NOAHZK_variable_width_signed_bitcnt(const NOAHZK_variable_width_t* const value){
+    return NOAHZK_variable_width_signed_bitcnt_primitive(value->arr, value->width, value->sign);
+}
+
+// not constant-time
+size_t NOAHZK_variable_width_signed_bitcnt_vartime(const NOAHZK_variable_width_t* const value){
+    return NOAHZK_variable_width_signed_bitcnt_vartime_primitive(value->arr, value->width, value->sign);
+}
+
+// same as NOAHZK_variable_width_signed_bitcnt, but with NOAHZK_CACHE_BITCNT defined the result is kept in value->bitcnt until an op writes value,
+// so asking again is free. whether it was cached shows in the timing, the length itself doesn't.
+size_t NOAHZK_variable_width_signed_bitcnt_cached(NOAHZK_variable_width_t* const value){
+#ifdef NOAHZK_CACHE_BITCNT
+    if(!value->bitcnt) value->bitcnt = NOAHZK_variable_width_signed_bitcnt(value) + 1;
+    return value->bitcnt - 1;
+#else
+    return NOAHZK_variable_width_signed_bitcnt(value);
+#endif
 }
 
 size_t NOAHZK_variable_width_min_bytecnt_byte(const void* const real_value, const size_t size){
@@ -63,7 +128,7 @@ size_t NOAHZK_variable_width_min_bytecnt_byte(const void* const real_value, cons
 }
 
 size_t NOAHZK_variarble_width_min_bytecnt(const NOAHZK_variable_width_t* const value){
-    return NOAHZK_variable_width_min_bytecnt_byte(value->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(value));
+    return NOAHZK_SIZE_AS_ARR_OF_TYPE(NOAHZK_variable_width_min_bitcnt(value), BITS_IN_UINT8_T);
 }
 
 #endif
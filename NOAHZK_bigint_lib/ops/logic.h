@@ -13,13 +13,14 @@
 #include "type.h"               // NOAHZK_variable_width_copy_properties
 #include "add.h"                // NOAHZK_variable_width_add_constant
 
-void NOAHZK_variable_width_invert_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const size_t width_dst, const size_t width_src){
-    for(size_t i = 0; i < width_dst; i++) dst[i] = i < width_src? ~src[i]: NOAHZK_LIMB_MAX;
+// dst = ~src, with src sign-extended by sign_src past width_src limbs
+void NOAHZK_variable_width_invert_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const size_t width_dst, const size_t width_src, const NOAHZK_limb_t sign_src){
+    for(size_t i = 0; i < width_dst; i++) dst[i] = NOAHZK_variable_width_get_arr_inverted(src, width_src, sign_src, i);
 }
 
 // dst = ~src
 void NOAHZK_variable_width_invert(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src){
-    NOAHZK_variable_width_invert_primitive(dst->arr, src->arr, dst->width, src->width);
+    NOAHZK_variable_width_invert_primitive(dst->arr, src->arr, dst->width, src->width, src->sign);
     NOAHZK_variable_width_update_sign(dst);
 }
 
@@ -29,10 +30,145 @@ void NOAHZK_variable_width_negate(NOAHZK_variable_width_t* const dst, const NOAH
     NOAHZK_variable_width_add_constant(dst, dst, 1);
 }
 
-void NOAHZK_variable_width_invert_conditionally_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const size_t width_dst, const size_t width_src, NOAHZK_op_t op){
+// dst = op? ~src: src, with src sign-extended by sign_src past width_src limbs
+void NOAHZK_variable_width_invert_conditionally_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const size_t width_dst, const size_t width_src, const NOAHZK_limb_t sign_src, NOAHZK_op_t op){
     const NOAHZK_limb_t mask = -op;
     
-    for(size_t i = 0; i < width_dst; i++) dst[i] = (i < width_src? src[i]: NOAHZK_LIMB_MAX) ^ mask;
+    for(size_t i = 0; i < width_dst; i++) dst[i] = (NOAHZK_limb_t)NOAHZK_variable_width_get_arr(src, width_src, sign_src, i) ^ mask;
+}
+
+// if op == 1, swaps rs0 & rs1 (both width limbs wide); if op == 0, leaves them as they are. constant-time regardless of op
+void NOAHZK_variable_width_swap_conditionally_primitive(NOAHZK_limb_t* const restrict rs0, NOAHZK_limb_t* const restrict rs1, const size_t width, NOAHZK_op_t op){
+    const NOAHZK_limb_t mask = -op;
+
+    for(size_t i = 0; i < width; i++){
+        const NOAHZK_limb_t difference = (rs0[i] ^ rs1[i]) & mask;
+        rs0[i] ^= difference;
+        rs1[i] ^= difference;
+    }
+}
+
+// comparisons & conditional moves. all of them are constant-time, as long as the widths are: every limb is read whatever the values,
+// & the outcome only goes into masks. each array is sign-extended past its width, as in NOAHZK_variable_width_get_arr, so the widths may differ.
+// the loops over the limbs both operands have are branch-free so they vectorise; the sign-extended tails are done separately.
+
+// 1 if x != 0, 0 otherwise, without comparing: x | -x has its top bit set unless x == 0
+NOAHZK_limb_t NOAHZK_variable_width_nonzero(const NOAHZK_limb_t x){
+    return (NOAHZK_limb_t)(x | -x) >> (BITS_IN_NOAHZK_LIMB - 1);
+}
+
+// ORs together rs0[i] ^ rs1[i] over max(width0, width1) limbs; 0 iff the two are equal
+NOAHZK_limb_t NOAHZK_variable_width_difference_primitive(const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, const NOAHZK_limb_t sign0, const NOAHZK_limb_t sign1){
+    const size_t width_common = NOAHZK_MIN(width0, width1), width = NOAHZK_MAX(width0, width1);
+    NOAHZK_limb_t difference = 0;
+
+    for(size_t i = 0; i < width_common; i++) difference |= rs0[i] ^ rs1[i];
+    for(size_t i = width_common; i < width; i++) difference |= (NOAHZK_limb_t)(NOAHZK_variable_width_get_arr(rs0, width0, sign0, i) ^ NOAHZK_variable_width_get_arr(rs1, width1, sign1, i));
+    return difference;
+}
+
+// 1 if rs0 == rs1, 0 otherwise
+NOAHZK_limb_t NOAHZK_variable_width_eq_primitive(const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, const NOAHZK_limb_t sign0, const NOAHZK_limb_t sign1){
+    return NOAHZK_variable_width_nonzero(NOAHZK_variable_width_difference_primitive(rs0, rs1, width0, width1, sign0, sign1)) ^ 1;
+}
+
+// compares rs0 & rs1 as two's complement numbers: returns -1 (all ones) if rs0 < rs1, 0 if they're equal & 1 if rs0 > rs1.
+// rs0 < rs1 iff rs0 - rs1 is negative, which it can be told from once it's a limb wider than both, so the borrow chain runs one limb past them.
+NOAHZK_limb_t NOAHZK_variable_width_cmp_primitive(const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, const NOAHZK_limb_t sign0, const NOAHZK_limb_t sign1){
+    const size_t width_common = NOAHZK_MIN(width0, width1), width = NOAHZK_MAX(width0, width1) + 1;
+    NOAHZK_limb_t carry = 1, top = 0;
+
+    for(size_t i = 0; i < width_common; i++){
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)rs0[i] + (NOAHZK_limb_t)~rs1[i] + carry;
+        carry = NOAHZK_variable_width_get_out(z);
+    }
+    for(size_t i = width_common; i < width; i++){
+        const NOAHZK_expanded_limb_t z = NOAHZK_variable_width_get_arr(rs0, width0, sign0, i) + NOAHZK_variable_width_get_arr_inverted(rs1, width1, sign1, i) + carry;
+        top = z & NOAHZK_LIMB_MAX;
+        carry = NOAHZK_variable_width_get_out(z);
+    }
+
+    const NOAHZK_limb_t lt = top >> (BITS_IN_NOAHZK_LIMB - 1);
+    const NOAHZK_limb_t ne = NOAHZK_variable_width_nonzero(NOAHZK_variable_width_difference_primitive(rs0, rs1, width0, width1, sign0, sign1));
+    return -lt | (ne ^ lt);
+}
+
+// dst = op? rs1: rs0, truncated or sign-extended to width_dst limbs. dst may alias either source
+void NOAHZK_variable_width_select_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width_dst, const size_t width0, const size_t width1, const NOAHZK_limb_t sign0, const NOAHZK_limb_t sign1, NOAHZK_op_t op){
+    const NOAHZK_limb_t mask = -op;
+    const size_t width_common = NOAHZK_MIN(width_dst, NOAHZK_MIN(width0, width1));
+
+    for(size_t i = 0; i < width_common; i++) dst[i] = rs0[i] ^ ((rs0[i] ^ rs1[i]) & mask);
+    for(size_t i = width_common; i < width_dst; i++){
+        const NOAHZK_limb_t limb0 = NOAHZK_variable_width_get_arr(rs0, width0, sign0, i), limb1 = NOAHZK_variable_width_get_arr(rs1, width1, sign1, i);
+        dst[i] = limb0 ^ ((limb0 ^ limb1) & mask);
+    }
+}
+
+// dst = op? src: dst, with src truncated or sign-extended to width_dst limbs
+void NOAHZK_variable_width_copy_conditionally_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const size_t width_dst, const size_t width_src, const NOAHZK_limb_t sign_src, NOAHZK_op_t op){
+    NOAHZK_variable_width_select_primitive(dst, dst, src, width_dst, width_dst, width_src, 0, sign_src, op);
+}
+
+// 1 if rs0 == rs1, 0 otherwise
+NOAHZK_limb_t NOAHZK_variable_width_eq(const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1){
+    return NOAHZK_variable_width_eq_primitive(rs0->arr, rs1->arr, rs0->width, rs1->width, rs0->sign, rs1->sign);
+}
+
+// -1 (all ones) if rs0 < rs1, 0 if rs0 == rs1, 1 if rs0 > rs1
+NOAHZK_limb_t NOAHZK_variable_width_cmp(const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1){
+    return NOAHZK_variable_width_cmp_primitive(rs0->arr, rs1->arr, rs0->width, rs1->width, rs0->sign, rs1->sign);
+}
+
+// dst = op? rs1: rs0, truncated or sign-extended to dst's width; the sign is selected along with the limbs. dst may alias either source
+void NOAHZK_variable_width_select(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1, NOAHZK_op_t op){
+    const NOAHZK_limb_t sign0 = rs0->sign, sign1 = rs1->sign;
+    NOAHZK_variable_width_select_primitive(dst->arr, rs0->arr, rs1->arr, dst->width, rs0->width, rs1->width, sign0, sign1, op);
+    dst->sign = sign0 ^ ((sign0 ^ sign1) & -op);
+    NOAHZK_variable_width_drop_bitcnt(dst);
+}
+
+// dst = op? src: dst, with src truncated or sign-extended to dst's width
+void NOAHZK_variable_width_copy_conditionally(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, NOAHZK_op_t op){
+    NOAHZK_variable_width_select(dst, dst, src, op);
+}
+
+// if op == 1, swaps the values of rs0 & rs1, each truncated or sign-extended to the other's width; if op == 0, leaves them as they are
+void NOAHZK_variable_width_swap_conditionally(NOAHZK_variable_width_t* const rs0, NOAHZK_variable_width_t* const rs1, NOAHZK_op_t op){
+    const NOAHZK_limb_t mask = -op;
+    const size_t width_common = NOAHZK_MIN(rs0->width, rs1->width), width = NOAHZK_MAX(rs0->width, rs1->width);
+    const NOAHZK_limb_t sign0 = rs0->sign, sign1 = rs1->sign;
+
+    NOAHZK_variable_width_swap_conditionally_primitive(rs0->arr, rs1->arr, width_common, op);
+    for(size_t i = width_common; i < width; i++){
+        const NOAHZK_limb_t limb0 = NOAHZK_variable_width_get_arr(rs0->arr, rs0->width, sign0, i), limb1 = NOAHZK_variable_width_get_arr(rs1->arr, rs1->width, sign1, i);
+        const NOAHZK_limb_t difference = (limb0 ^ limb1) & mask;
+        if(i < rs0->width) rs0->arr[i] = limb0 ^ difference;
+        if(i < rs1->width) rs1->arr[i] = limb1 ^ difference;
+    }
+
+    rs0->sign = sign0 ^ ((sign0 ^ sign1) & mask);
+    NOAHZK_variable_width_drop_bitcnt(rs0);
+    rs1->sign = sign1 ^ ((sign0 ^ sign1) & mask);
+    NOAHZK_variable_width_drop_bitcnt(rs1);
+}
+
+// dst = the smaller of rs0 & rs1. dst may alias either
+void NOAHZK_variable_width_min(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1){
+    const NOAHZK_limb_t lt = NOAHZK_variable_width_cmp(rs0, rs1) >> (BITS_IN_NOAHZK_LIMB - 1);
+    NOAHZK_variable_width_select(dst, rs1, rs0, lt);
+}
+
+// dst = the larger of rs0 & rs1. dst may alias either
+void NOAHZK_variable_width_max(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1){
+    const NOAHZK_limb_t lt = NOAHZK_variable_width_cmp(rs0, rs1) >> (BITS_IN_NOAHZK_LIMB - 1);
+    NOAHZK_variable_width_select(dst, rs0, rs1, lt);
+}
+
+// dst = op? -src: src, over equally wide arrays; constant-time regardless of op
+void NOAHZK_variable_width_negate_conditionally_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const size_t width, NOAHZK_op_t op){
+    NOAHZK_variable_width_invert_conditionally_primitive(dst, src, width, width, 0, op);
+    NOAHZK_variable_width_add_constant_primitive(dst, dst, op, width, width, 0);
 }
 
 // if op == 1, negates src and stores it in dst
@@ -40,7 +176,7 @@ void NOAHZK_variable_width_invert_conditionally_primitive(NOAHZK_limb_t* const d
 // the value of op may be either 1 or 0. undefined what happens otherwise
 // all in constant time, regardless of the value of op B))
 void NOAHZK_variable_width_negate_conditionally(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, NOAHZK_op_t op){
-    NOAHZK_variable_width_invert_conditionally_primitive(dst->arr, src->arr, dst->width, src->width, op);
+    NOAHZK_variable_width_invert_conditionally_primitive(dst->arr, src->arr, dst->width, src->width, src->sign, op);
 // we don't have to update the sign because add_constant updates it later and the sign being updated or not doesn't change anything in add_constant (in this case).
     NOAHZK_variable_width_add_constant(dst, dst, op);
 }
@@ -0,0 +1,280 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+#ifndef NOAHZK_bigint_montgomery_included
+#define NOAHZK_bigint_montgomery_included
+
+#include "definitions.h"    // NOAHZK variable-width type
+#include "type.h"           // ops to allocate, destroy variable width types
+#include "add.h"            // variable-width addition
+#include "sub.h"            // variable-width subtraction
+#include "mul.h"            // limb multiplication kernels, NOAHZK_limb_inverse
+#include "workspace.h"      // scratch for the products & zero-extended operands
+#include "stdint.h"         // integer types
+#include "string.h"         // memset, memcpy
+
+// modular arithmetic in Montgomery form, for an odd modulus N that is width limbs wide.
+// with R = 2^(width*BITS_IN_NOAHZK_LIMB), x is kept as x*R mod N, so that reducing a product only takes multiplications & shifts.
+// residues are always exactly width limbs wide & in [0, N); all of them are unsigned.
+// every op on residues is constant-time; setting up a context isn't (the modulus is public).
+// the ops that need scratch have _scratch variants that take it from the caller, sized by the matching _scratch_size function,
+// & variants without the suffix that take it from the default workspace, like the multiplication kernels.
+
+typedef struct{
+    size_t width;                       // width of N, & every residue, in limbs
+    NOAHZK_variable_width_t modulus;    // N
+    NOAHZK_variable_width_t r;          // R mod N; 1 in Montgomery form
+    NOAHZK_variable_width_t r2;         // R^2 mod N; used to convert into Montgomery form
+    NOAHZK_limb_t n0_inv_neg;           // -N^-1 mod 2^BITS_IN_NOAHZK_LIMB
+} NOAHZK_montgomery_ctx_t;
+
+// dst = src - N if top (the limb above src) is set or src >= N, otherwise src. takes src < 2N.
+// the borrow out of src - N is found first, without storing the difference, then N is subtracted under a mask, so it needs no scratch.
+// dst may alias src. constant-time
+void NOAHZK_variable_width_mont_reduce_once_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const NOAHZK_limb_t top, const NOAHZK_limb_t* const modulus, const size_t width){
+// subtracts by adding the complement, the same as sub_primitive; the carry out is 1 if nothing was borrowed
+    NOAHZK_limb_t no_borrow = 1;
+    for(size_t i = 0; i < width; i++) no_borrow = NOAHZK_variable_width_get_out((NOAHZK_expanded_limb_t)src[i] + (NOAHZK_limb_t)~modulus[i] + no_borrow);
+    const NOAHZK_limb_t mask = -(NOAHZK_limb_t)(top | no_borrow);
+
+    NOAHZK_limb_t carry = 1;
+    for(size_t i = 0; i < width; i++){
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)src[i] + (NOAHZK_limb_t)~(modulus[i] & mask) + carry;
+        dst[i] = z & NOAHZK_LIMB_MAX;
+        carry = NOAHZK_variable_width_get_out(z);
+    }
+}
+
+// Montgomery reduction: dst = src*R^-1 mod N, where src is 2*width limbs wide & src < N*R. src gets overwritten.
+// dst may alias src. constant-time
+void NOAHZK_variable_width_mont_redc_primitive(NOAHZK_limb_t* const dst, NOAHZK_limb_t* const src, const NOAHZK_limb_t* const modulus, const NOAHZK_limb_t n0_inv_neg, const size_t width){
+    NOAHZK_limb_t top = 0;
+
+// each step makes the lowest limb left 0 by adding a multiple of N, so it can be shifted out
+    for(size_t i = 0; i < width; i++){
+        const NOAHZK_limb_t m = src[i] * n0_inv_neg;
+        const NOAHZK_limb_t carry = NOAHZK_variable_width_addmul_arr_with_limb(src + i, modulus, m, width);
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)src[i + width] + carry + top;
+        src[i + width] = z & NOAHZK_LIMB_MAX;
+        top = NOAHZK_variable_width_get_out(z);
+    }
+
+    NOAHZK_variable_width_mont_reduce_once_primitive(dst, src + width, top, modulus, width);
+}
+
+// limbs of scratch NOAHZK_variable_width_mont_mul_primitive_scratch needs: the running sum or product, & the multiplication's scratch
+size_t NOAHZK_variable_width_mont_mul_primitive_scratch_size(const size_t width){
+    return 2*width + 2 + NOAHZK_variable_width_mul_dispatch_scratch_size(width, width);
+}
+
+// dst = rs0*rs1*R^-1 mod N, for rs0, rs1 < N; all of them width limbs wide.
+// small moduli interleave multiplication & reduction (CIOS), wider ones multiply with the Karatsuba/Toom tiers first & reduce afterwards.
+// dst may alias either source. scratch has to be NOAHZK_variable_width_mont_mul_primitive_scratch_size(width) limbs wide. constant-time
+void NOAHZK_variable_width_mont_mul_primitive_scratch(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const NOAHZK_limb_t* const modulus, const NOAHZK_limb_t n0_inv_neg, const size_t width, NOAHZK_limb_t* const scratch){
+    NOAHZK_limb_t* const t = scratch;
+
+    if(width > NOAHZK_MUL_KARATSUBA_THRESHOLD){
+        NOAHZK_variable_width_mul_dispatch_scratch(t, rs0, rs1, width, width, scratch + 2*width + 2);
+        NOAHZK_variable_width_mont_redc_primitive(dst, t, modulus, n0_inv_neg, width);
+        return;
+    }
+
+    memset(t, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(2*width + 2));
+// t + i holds the running sum, shifted down by i limbs; every row adds rs0*rs1[i], then a multiple of N that clears t[i]
+    for(size_t i = 0; i < width; i++){
+        NOAHZK_limb_t carry = NOAHZK_variable_width_addmul_arr_with_limb(t + i, rs0, rs1[i], width);
+        NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)t[i + width] + carry;
+        t[i + width] = z & NOAHZK_LIMB_MAX;
+        t[i + width + 1] += NOAHZK_variable_width_get_out(z);
+
+        const NOAHZK_limb_t m = t[i] * n0_inv_neg;
+        carry = NOAHZK_variable_width_addmul_arr_with_limb(t + i, modulus, m, width);
+        z = (NOAHZK_expanded_limb_t)t[i + width] + carry;
+        t[i + width] = z & NOAHZK_LIMB_MAX;
+        t[i + width + 1] += NOAHZK_variable_width_get_out(z);
+    }
+
+    NOAHZK_variable_width_mont_reduce_once_primitive(dst, t + width, t[2*width], modulus, width);
+}
+
+// same as above, with scratch from the default workspace
+void NOAHZK_variable_width_mont_mul_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const NOAHZK_limb_t* const modulus, const NOAHZK_limb_t n0_inv_neg, const size_t width){
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_mont_mul_primitive_scratch_size(width));
+    NOAHZK_variable_width_mont_mul_primitive_scratch(dst, rs0, rs1, modulus, n0_inv_neg, width, scratch);
+}
+
+size_t NOAHZK_variable_width_mont_sqr_primitive_scratch_size(const size_t width){
+    return 2*width + NOAHZK_variable_width_sqr_dispatch_scratch_size(width);
+}
+
+// dst = src^2*R^-1 mod N, for src < N; squares with NOAHZK_variable_width_sqr_dispatch_scratch, then reduces.
+// dst may alias src. scratch has to be NOAHZK_variable_width_mont_sqr_primitive_scratch_size(width) limbs wide. constant-time
+void NOAHZK_variable_width_mont_sqr_primitive_scratch(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const NOAHZK_limb_t* const modulus, const NOAHZK_limb_t n0_inv_neg, const size_t width, NOAHZK_limb_t* const scratch){
+    NOAHZK_variable_width_sqr_dispatch_scratch(scratch, src, width, scratch + 2*width);
+    NOAHZK_variable_width_mont_redc_primitive(dst, scratch, modulus, n0_inv_neg, width);
+}
+
+// same as above, with scratch from the default workspace
+void NOAHZK_variable_width_mont_sqr_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const NOAHZK_limb_t* const modulus, const NOAHZK_limb_t n0_inv_neg, const size_t width){
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_mont_sqr_primitive_scratch_size(width));
+    NOAHZK_variable_width_mont_sqr_primitive_scratch(dst, src, modulus, n0_inv_neg, width, scratch);
+}
+
+// dst = rs0 + rs1 mod N, for rs0, rs1 < N. dst may alias either source. constant-time
+void NOAHZK_variable_width_mont_add_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const NOAHZK_limb_t* const modulus, const size_t width){
+    const NOAHZK_limb_t carry = NOAHZK_variable_width_add_primitive(dst, rs0, rs1, width, width, width, 0, 0);
+    NOAHZK_variable_width_mont_reduce_once_primitive(dst, dst, carry, modulus, width);
+}
+
+// dst = rs0 - rs1 mod N, for rs0, rs1 < N. dst may alias either source. constant-time
+void NOAHZK_variable_width_mont_sub_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const NOAHZK_limb_t* const modulus, const size_t width){
+    const NOAHZK_limb_t borrow = NOAHZK_variable_width_sub_primitive(dst, rs0, rs1, width, width, width, 0, 0) ^ 1;
+    const NOAHZK_limb_t mask = -borrow;
+
+    NOAHZK_limb_t carry = 0;
+    for(size_t i = 0; i < width; i++){
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)dst[i] + (modulus[i] & mask) + carry;
+        dst[i] = z & NOAHZK_LIMB_MAX;
+        carry = NOAHZK_variable_width_get_out(z);
+    }
+}
+
+// context setup
+
+// not constant-time
+// initialises ctx for the modulus passed, or returns ptr to a new context if NULL is passed for it.
+// the modulus has to be odd & greater than 1; returns NULL otherwise.
+void* NOAHZK_montgomery_ctx_init(NOAHZK_montgomery_ctx_t* ctx, const NOAHZK_variable_width_t* const modulus){
+    size_t width = modulus->width;
+    while(width && !modulus->arr[width - 1]) width--;
+    if(!width || modulus->sign || !(modulus->arr[0] & 1) || (width == 1 && modulus->arr[0] == 1)) return NULL;
+
+    if(!ctx) ctx = NOAHZK_malloc(sizeof(NOAHZK_montgomery_ctx_t));
+
+    ctx->width = width;
+    NOAHZK_variable_width_init_arr(&ctx->modulus, modulus->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    NOAHZK_variable_width_init(&ctx->r, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    NOAHZK_variable_width_init(&ctx->r2, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    ctx->n0_inv_neg = -NOAHZK_limb_inverse(modulus->arr[0]);
+
+// R mod N & R^2 mod N by doubling 1 modulo N, width*BITS_IN_NOAHZK_LIMB times each. R is copied out halfway, rather than swapping
+// the two arrays after, as either may be kept inside its var
+    NOAHZK_limb_t* const x = ctx->r2.arr;
+    x[0] = 1;
+    for(size_t i = 0; i < 2*width*BITS_IN_NOAHZK_LIMB; i++){
+        NOAHZK_variable_width_mont_add_primitive(x, x, x, ctx->modulus.arr, width);
+        if(i + 1 == width*BITS_IN_NOAHZK_LIMB) memcpy(ctx->r.arr, x, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    }
+
+    return ctx;
+}
+
+void NOAHZK_montgomery_ctx_destroy(NOAHZK_montgomery_ctx_t* const todestroy, const NOAHZK_variable_width_option_t freeptr){
+    NOAHZK_variable_width_destroy(&todestroy->modulus, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&todestroy->r, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&todestroy->r2, NOAHZK_variable_width_keep_ptr);
+    todestroy->width = 0;
+    todestroy->n0_inv_neg = 0;
+
+    if(freeptr == NOAHZK_variable_width_free_ptr) NOAHZK_free(todestroy, sizeof(NOAHZK_montgomery_ctx_t));
+}
+
+// initialises toinit to a residue (0) of ctx, or returns ptr to a new one if NULL is passed for it
+void* NOAHZK_montgomery_ctx_init_element(const NOAHZK_montgomery_ctx_t* const ctx, NOAHZK_variable_width_t* toinit){
+    return NOAHZK_variable_width_init(toinit, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(ctx->width));
+}
+
+// ops over variable-width vars
+// dst has to be at least ctx->width limbs wide; the result is written to its lowest ctx->width limbs & the rest is cleared.
+// sources narrower than ctx->width are zero-extended, wider ones are read up to ctx->width limbs.
+
+// returns src's array if it's wide enough, otherwise src zero-extended into scratch (ctx->width limbs)
+const NOAHZK_limb_t* NOAHZK_variable_width_mont_operand(NOAHZK_limb_t* const scratch, const NOAHZK_variable_width_t* const src, const NOAHZK_montgomery_ctx_t* const ctx){
+    if(src->width >= ctx->width) return src->arr;
+    for(size_t i = 0; i < ctx->width; i++) scratch[i] = NOAHZK_variable_width_get_arr(src->arr, src->width, 0, i);
+    return scratch;
+}
+
+void NOAHZK_variable_width_mont_finish(NOAHZK_variable_width_t* const dst, const NOAHZK_montgomery_ctx_t* const ctx){
+    memset(dst->arr + ctx->width, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(dst->width - ctx->width));
+    dst->sign = 0;
+    NOAHZK_variable_width_drop_bitcnt(dst);
+}
+
+// limbs of scratch any of the _scratch ops below needs: room to zero-extend both operands, then for the product & its multiplication's scratch
+size_t NOAHZK_variable_width_mont_scratch_size(const NOAHZK_montgomery_ctx_t* const ctx){
+    const size_t width = ctx->width;
+    return 2*width + NOAHZK_MAX(NOAHZK_variable_width_mont_mul_primitive_scratch_size(width), NOAHZK_variable_width_mont_sqr_primitive_scratch_size(width));
+}
+
+// dst = rs0*rs1*R^-1 mod N; the Montgomery form of the product, if rs0 & rs1 are in Montgomery form.
+// scratch has to be NOAHZK_variable_width_mont_scratch_size(ctx) limbs wide, as with every _scratch op below.
+void NOAHZK_variable_width_mont_mul_scratch(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1, const NOAHZK_montgomery_ctx_t* const ctx, NOAHZK_limb_t* const scratch){
+    const NOAHZK_limb_t* const a = NOAHZK_variable_width_mont_operand(scratch, rs0, ctx), *const b = NOAHZK_variable_width_mont_operand(scratch + ctx->width, rs1, ctx);
+    NOAHZK_variable_width_mont_mul_primitive_scratch(dst->arr, a, b, ctx->modulus.arr, ctx->n0_inv_neg, ctx->width, scratch + 2*ctx->width);
+    NOAHZK_variable_width_mont_finish(dst, ctx);
+}
+
+void NOAHZK_variable_width_mont_mul(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1, const NOAHZK_montgomery_ctx_t* const ctx){
+    NOAHZK_variable_width_mont_mul_scratch(dst, rs0, rs1, ctx, NOAHZK_default_workspace_get(NOAHZK_variable_width_mont_scratch_size(ctx)));
+}
+
+// dst = src^2*R^-1 mod N
+void NOAHZK_variable_width_mont_sqr_scratch(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const NOAHZK_montgomery_ctx_t* const ctx, NOAHZK_limb_t* const scratch){
+    NOAHZK_variable_width_mont_sqr_primitive_scratch(dst->arr, NOAHZK_variable_width_mont_operand(scratch, src, ctx), ctx->modulus.arr, ctx->n0_inv_neg, ctx->width, scratch + 2*ctx->width);
+    NOAHZK_variable_width_mont_finish(dst, ctx);
+}
+
+void NOAHZK_variable_width_mont_sqr(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const NOAHZK_montgomery_ctx_t* const ctx){
+    NOAHZK_variable_width_mont_sqr_scratch(dst, src, ctx, NOAHZK_default_workspace_get(NOAHZK_variable_width_mont_scratch_size(ctx)));
+}
+
+// dst = rs0 + rs1 mod N; works the same in & out of Montgomery form.
+void NOAHZK_variable_width_add_mod_scratch(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1, const NOAHZK_montgomery_ctx_t* const ctx, NOAHZK_limb_t* const scratch){
+    const NOAHZK_limb_t* const a = NOAHZK_variable_width_mont_operand(scratch, rs0, ctx), *const b = NOAHZK_variable_width_mont_operand(scratch + ctx->width, rs1, ctx);
+    NOAHZK_variable_width_mont_add_primitive(dst->arr, a, b, ctx->modulus.arr, ctx->width);
+    NOAHZK_variable_width_mont_finish(dst, ctx);
+}
+
+void NOAHZK_variable_width_add_mod(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1, const NOAHZK_montgomery_ctx_t* const ctx){
+    NOAHZK_variable_width_add_mod_scratch(dst, rs0, rs1, ctx, NOAHZK_default_workspace_get(NOAHZK_variable_width_mont_scratch_size(ctx)));
+}
+
+// dst = rs0 - rs1 mod N; works the same in & out of Montgomery form.
+void NOAHZK_variable_width_sub_mod_scratch(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1, const NOAHZK_montgomery_ctx_t* const ctx, NOAHZK_limb_t* const scratch){
+    const NOAHZK_limb_t* const a = NOAHZK_variable_width_mont_operand(scratch, rs0, ctx), *const b = NOAHZK_variable_width_mont_operand(scratch + ctx->width, rs1, ctx);
+    NOAHZK_variable_width_mont_sub_primitive(dst->arr, a, b, ctx->modulus.arr, ctx->width);
+    NOAHZK_variable_width_mont_finish(dst, ctx);
+}
+
+void NOAHZK_variable_width_sub_mod(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1, const NOAHZK_montgomery_ctx_t* const ctx){
+    NOAHZK_variable_width_sub_mod_scratch(dst, rs0, rs1, ctx, NOAHZK_default_workspace_get(NOAHZK_variable_width_mont_scratch_size(ctx)));
+}
+
+// dst = src*R mod N, for src < N
+void NOAHZK_variable_width_to_mont_scratch(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const NOAHZK_montgomery_ctx_t* const ctx, NOAHZK_limb_t* const scratch){
+    NOAHZK_variable_width_mont_mul_scratch(dst, src, &ctx->r2, ctx, scratch);
+}
+
+void NOAHZK_variable_width_to_mont(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const NOAHZK_montgomery_ctx_t* const ctx){
+    NOAHZK_variable_width_mont_mul(dst, src, &ctx->r2, ctx);
+}
+
+// dst = src*R^-1 mod N; takes src out of Montgomery form
+void NOAHZK_variable_width_from_mont_scratch(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const NOAHZK_montgomery_ctx_t* const ctx, NOAHZK_limb_t* const scratch){
+    NOAHZK_limb_t* const t = scratch;
+    for(size_t i = 0; i < 2*ctx->width; i++) t[i] = i < ctx->width? NOAHZK_variable_width_get_arr(src->arr, src->width, 0, i): 0;
+    NOAHZK_variable_width_mont_redc_primitive(dst->arr, t, ctx->modulus.arr, ctx->n0_inv_neg, ctx->width);
+    NOAHZK_variable_width_mont_finish(dst, ctx);
+}
+
+void NOAHZK_variable_width_from_mont(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const NOAHZK_montgomery_ctx_t* const ctx){
+    NOAHZK_variable_width_from_mont_scratch(dst, src, ctx, NOAHZK_default_workspace_get(NOAHZK_variable_width_mont_scratch_size(ctx)));
+}
+
+#endif
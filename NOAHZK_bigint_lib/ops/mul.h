@@ -12,119 +12,758 @@
 #include "definitions.h"    // NOAHZK variable-width type
 #include "logarithms.h"     // bit and byte width of constants and arrays
 #include "stdint.h"         // integer types
-#include "stdlib.h"         // dynamic memory operations
 #include "string.h"         // memset
 #include "logic.h"          // NOAHZK_variable_width_negate_conditionally
 #include "type.h"           // ops to allocate, destroy variable width types 
 #include "add.h"            // variable-width addition 
 #include "sub.h"            // variable-width subtraction
+#include "ntt.h"            // NTT multiplication for very wide operands
+#include "workspace.h"      // scratch for the multiplication kernels
+#include "cpu.h"            // addmul_1 & base case kernels picked for this cpu
+#include "shift.h"          // NOAHZK_variable_width_shift_right
+
+// tunable thresholds, in limbs of the smaller operand, above which each multiplication tier takes over from the one below it
+#ifndef NOAHZK_MUL_KARATSUBA_THRESHOLD
+#define NOAHZK_MUL_KARATSUBA_THRESHOLD 32
+#endif
+// Karatsuba's middle product is one limb wider than half the operands, so it only shrinks them from 4 limbs up
+#if NOAHZK_MUL_KARATSUBA_THRESHOLD < 3
+#error "NOAHZK_MUL_KARATSUBA_THRESHOLD has to be at least 3"
+#endif
+#ifndef NOAHZK_MUL_TOOM3_THRESHOLD
+#define NOAHZK_MUL_TOOM3_THRESHOLD 128
+#endif
+#ifndef NOAHZK_MUL_TOOM4_THRESHOLD
+#define NOAHZK_MUL_TOOM4_THRESHOLD 384
+#endif
+#ifndef NOAHZK_MUL_NTT_THRESHOLD
+#define NOAHZK_MUL_NTT_THRESHOLD 32768
+#endif
+
+// squaring has a cheaper base case, so it moves on to Karatsuba later
+#ifndef NOAHZK_SQR_KARATSUBA_THRESHOLD
+#define NOAHZK_SQR_KARATSUBA_THRESHOLD 40
+#endif
+#if NOAHZK_SQR_KARATSUBA_THRESHOLD < 3
+#error "NOAHZK_SQR_KARATSUBA_THRESHOLD has to be at least 3"
+#endif
+#ifndef NOAHZK_SQR_TOOM3_THRESHOLD
+#define NOAHZK_SQR_TOOM3_THRESHOLD NOAHZK_MUL_TOOM3_THRESHOLD
+#endif
+#ifndef NOAHZK_SQR_TOOM4_THRESHOLD
+#define NOAHZK_SQR_TOOM4_THRESHOLD NOAHZK_MUL_TOOM4_THRESHOLD
+#endif
+
+typedef enum{ NOAHZK_variable_width_constant_time = 0, NOAHZK_variable_width_variable_time = 1 } NOAHZK_variable_width_timing_t;
 
-// only constant-time if shamt is.
-void NOAHZK_variable_width_shift_right_constant(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const size_t shamt){
-    NOAHZK_limb_t dst_arr[dst->width];
-    memset(dst_arr, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(dst));
-    if(shamt == 0) memcpy(dst_arr, dst->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(dst));
-    else if(shamt != NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR_BITS(dst)){
-        for(size_t i = NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR_BITS(dst) - 1; i >= shamt; i--)
-            dst_arr[(i - shamt)/BITS_IN_NOAHZK_LIMB] |= (src->arr[i/BITS_IN_NOAHZK_LIMB] >> (i % BITS_IN_NOAHZK_LIMB) & 1) << ((i - shamt)%BITS_IN_NOAHZK_LIMB);
+// dst = rs0*k, where rs0 is an array of width limbs and k a single limb; returns the high limb of the product.
+// dst may alias rs0.
+NOAHZK_limb_t NOAHZK_variable_width_mul_arr_with_limb(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t k, const size_t width){
+    NOAHZK_limb_t carry = 0;
+    for(size_t i = 0; i < width; i++){
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)rs0[i] * (NOAHZK_expanded_limb_t)k + carry;
+        dst[i] = z & NOAHZK_LIMB_MAX;
+        carry = z >> BITS_IN_NOAHZK_LIMB;
+    }
+    return carry;
+}
+
+// dst += rs0*k, over width limbs of dst; returns the limb carried out.
+// (2^n - 1)^2 + 2*(2^n - 1) == 2^2n - 1, so z never overflows NOAHZK_expanded_limb_t.
+NOAHZK_limb_t NOAHZK_variable_width_addmul_arr_with_limb(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t k, const size_t width){
+    return NOAHZK_kernels.addmul_1(dst, rs0, k, width);
+}
+
+// dst -= rs0*k, over width limbs of dst; returns the limb borrowed out.
+NOAHZK_limb_t NOAHZK_variable_width_submul_arr_with_limb(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t k, const size_t width){
+    NOAHZK_limb_t borrow = 0;
+    for(size_t i = 0; i < width; i++){
+        const NOAHZK_expanded_limb_t product = (NOAHZK_expanded_limb_t)rs0[i] * (NOAHZK_expanded_limb_t)k + borrow;
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)dst[i] - (product & NOAHZK_LIMB_MAX);
+        dst[i] = z & NOAHZK_LIMB_MAX;
+        borrow = (product >> BITS_IN_NOAHZK_LIMB) + NOAHZK_variable_width_get_out(z);
     }
+    return borrow;
+}
 
-    memcpy(dst->arr, dst_arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(dst));
+// returns the inverse of odd d modulo 2^BITS_IN_NOAHZK_LIMB.
+// d*d == 1 mod 8 for any odd d, and each Newton iteration doubles the number of correct bits.
+NOAHZK_limb_t NOAHZK_limb_inverse(const NOAHZK_limb_t d){
+    NOAHZK_limb_t inv = d;
+    for(size_t correct_bits = 3; correct_bits < BITS_IN_NOAHZK_LIMB; correct_bits *= 2) inv = (NOAHZK_limb_t)(inv * (NOAHZK_limb_t)(2 - d*inv));
+    return inv;
 }
 
-// multiplies array rs0 with byte rs1
-void NOAHZK_variable_width_mul_arr_with_byte(uint8_t* const dst, const uint8_t* const rs0, const uint8_t rs1, const size_t width){
-    uint16_t product = 0;
+// dst = src/d over width limbs, where d is odd and src is known to be a multiple of d.
+// works on two's complement values as well, as it computes src * d^-1 mod 2^(width*BITS_IN_NOAHZK_LIMB).
+// dst may alias src. constant-time 
+void NOAHZK_variable_width_divexact_by_limb_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const NOAHZK_limb_t d, const size_t width){
+    const NOAHZK_limb_t inv = NOAHZK_limb_inverse(d);
+    NOAHZK_limb_t borrow = 0;
+
     for(size_t i = 0; i < width; i++){
-        product += (uint16_t)rs0[i] * (uint16_t)rs1;
-        dst[i] = product;
-        product >>= BITS_IN_UINT8_T;        // this way if dst == rs1 dst[i] isn't overwritten until after we're done with rs1[i]
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)src[i] - borrow;
+        const NOAHZK_limb_t q = (NOAHZK_limb_t)(z & NOAHZK_LIMB_MAX) * inv;
+        dst[i] = q;
+        borrow = NOAHZK_variable_width_get_out(z) + (NOAHZK_limb_t)((NOAHZK_expanded_limb_t)q * d >> BITS_IN_NOAHZK_LIMB);
     }
-    dst[width] = product;
 }
 
-// basically 4-mul version of Karatsuba algorithm
-// had problems trying to implement 3-mul version
+// arr >>= shamt arithmetically, in place, where 0 < shamt < BITS_IN_NOAHZK_LIMB; width has to be nonzero.
+// only used for the exact divisions by powers of two in Toom interpolation.
+void NOAHZK_variable_width_shift_right_signed_small_primitive(NOAHZK_limb_t* const arr, const size_t width, const size_t shamt){
+    for(size_t i = 0; i + 1 < width; i++) arr[i] = arr[i] >> shamt | arr[i+1] << (BITS_IN_NOAHZK_LIMB - shamt);
+    const NOAHZK_limb_t sign_mask = -(arr[width-1] >> (BITS_IN_NOAHZK_LIMB - 1));
+    arr[width-1] = arr[width-1] >> shamt | sign_mask << (BITS_IN_NOAHZK_LIMB - shamt);
+}
+
+// dst = dst*k + src over width_dst limbs, for small k; the Horner step used to evaluate Toom polynomials.
+void NOAHZK_variable_width_horner_step_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t k, const NOAHZK_limb_t* const src, const size_t width_dst, const size_t width_src){
+    NOAHZK_variable_width_mul_arr_with_limb(dst, dst, k, width_dst);
+    NOAHZK_variable_width_add_primitive(dst, dst, src, width_dst, width_dst, width_src, 0, 0);
+}
+
+// dst -= src*k over width_dst limbs, where width_src <= width_dst; values are two's complement.
+void NOAHZK_variable_width_submul_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const NOAHZK_limb_t k, const size_t width_dst, const size_t width_src){
+    const NOAHZK_limb_t borrow = NOAHZK_variable_width_submul_arr_with_limb(dst, src, k, width_src);
+    NOAHZK_variable_width_sub_constant_primitive(dst + width_src, dst + width_src, borrow, width_dst - width_src, width_dst - width_src, 0);
+}
+
+// dst = rs0*rs1, writing all width0 + width1 limbs of dst. both widths have to be nonzero.
+// dst may not alias either source.
+void NOAHZK_variable_width_mul_schoolbook(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1){
+    NOAHZK_kernels.mul_basecase(dst, rs0, rs1, width0, width1);
+}
+
+void NOAHZK_variable_width_mul_dispatch_scratch(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, NOAHZK_limb_t* const scratch);
+
+// dst = rs0*rs1 for width1 <= ceil(width0/2): multiplies rs1 by width1-limb blocks of rs0, so every block product is balanced.
+// dst may not alias either source. the scratch arguments of these kernels are described at NOAHZK_variable_width_mul_dispatch_scratch_size.
+void NOAHZK_variable_width_mul_unbalanced(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, NOAHZK_limb_t* const scratch){
+    NOAHZK_limb_t* const block_product = scratch;
+    memset(dst, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width1));
+
+// each block product only overlaps the previous one over its lowest width1 limbs; the rest is just carried into
+    for(size_t offset = 0; offset < width0; offset += width1){
+        const size_t width_block = NOAHZK_MIN(width1, width0 - offset);
+        NOAHZK_variable_width_mul_dispatch_scratch(block_product, rs0 + offset, rs1, width_block, width1, scratch + 2*width1);
+
+        const NOAHZK_limb_t carry = NOAHZK_variable_width_add_primitive(dst + offset, dst + offset, block_product, width1, width1, width1, 0, 0);
+        NOAHZK_variable_width_add_constant_primitive(dst + offset + width1, block_product + width1, carry, width_block, width_block, 0);
+    }
+}
+
+// 3-mul Karatsuba: with h = ceil(width0/2), X = X1*B^h + X0 and Y = Y1*B^h + Y0,
+// X*Y = X1Y1*B^2h + ((X0 + X1)(Y0 + Y1) - X1Y1 - X0Y0)*B^h + X0Y0.
+// the sums are kept one limb wider instead of branching on their carries, so it stays constant-time.
+// requires width0 >= width1 > h. dst may not alias either source.
+// takes 4*(h+1) limbs of scratch for itself; I don't want to use dynamic memory allocation as it'd just be slow.
+void NOAHZK_variable_width_mul_karatsuba(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, NOAHZK_limb_t* const scratch){
+    const size_t h = width0 - width0/2;
+    const size_t width_dst = width0 + width1;
+    const size_t width_sum = h + 1, width_middle = 2*width_sum;
+    NOAHZK_limb_t* const sum0 = scratch, *const sum1 = sum0 + width_sum, *const middle = sum1 + width_sum, *const scratch_children = middle + width_middle;
+
+// X0Y0 and X1Y1 don't overlap, so they go straight into dst
+    NOAHZK_variable_width_mul_dispatch_scratch(dst, rs0, rs1, h, h, scratch_children);
+    NOAHZK_variable_width_mul_dispatch_scratch(dst + 2*h, rs0 + h, rs1 + h, width0 - h, width1 - h, scratch_children);
+
+    NOAHZK_variable_width_add_primitive(sum0, rs0, rs0 + h, width_sum, h, width0 - h, 0, 0);
+    NOAHZK_variable_width_add_primitive(sum1, rs1, rs1 + h, width_sum, h, width1 - h, 0, 0);
+    NOAHZK_variable_width_mul_dispatch_scratch(middle, sum0, sum1, width_sum, width_sum, scratch_children);
+
+    NOAHZK_variable_width_sub_primitive(middle, middle, dst, width_middle, width_middle, 2*h, 0, 0);
+    NOAHZK_variable_width_sub_primitive(middle, middle, dst + 2*h, width_middle, width_middle, width_dst - 2*h, 0, 0);
+// the limbs of middle that don't fit are always 0, as the whole product fits in width_dst limbs
+    NOAHZK_variable_width_add_primitive(dst + h, dst + h, middle, width_dst - h, width_dst - h, width_middle, 0, 0);
+}
+
+// turns the unsigned product of two two's complement arrays into their signed product, in place.
+// reading a two's complement x of width limbs as unsigned gives x + sign*B^width, so
+// rs0*rs1 = u0*u1 - sign0*u1*B^width0 - sign1*u0*B^width1 mod B^(width0 + width1), & the signed product always fits in width0 + width1 limbs.
+// both corrections are masked by the signs & subtracted in the same pass, over the limbs they touch only. constant-time 
+// product is width0 + width1 limbs wide & may not alias either source.
+void NOAHZK_variable_width_mul_signed_fixup_primitive(NOAHZK_limb_t* const restrict product, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, const NOAHZK_limb_t sign0, const NOAHZK_limb_t sign1){
+    const NOAHZK_limb_t mask0 = -sign0, mask1 = -sign1;
+    const size_t width_product = width0 + width1;
+
+// subtracts both by adding their complements & 2 to the lowest limb; the carry never goes past 2
+    NOAHZK_limb_t carry = 2;
+    for(size_t i = NOAHZK_MIN(width0, width1); i < width_product; i++){
+        const NOAHZK_limb_t t0 = i >= width0? rs1[i - width0] & mask0: 0;
+        const NOAHZK_limb_t t1 = i >= width1? rs0[i - width1] & mask1: 0;
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)product[i] + (NOAHZK_limb_t)~t0 + (NOAHZK_limb_t)~t1 + carry;
+        product[i] = z & NOAHZK_LIMB_MAX;
+        carry = z >> BITS_IN_NOAHZK_LIMB;
+    }
+}
+
+// dst = rs0*rs1 in two's complement over 2*width limbs, where rs0 & rs1 are two's complement arrays of width limbs.
+// used for Toom's evaluations at negative points; the operands are multiplied as they are, then fixed up. dst may not alias either source. constant-time 
+void NOAHZK_variable_width_mul_signed_arr(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width, NOAHZK_limb_t* const scratch){
+    const NOAHZK_limb_t sign0 = rs0[width-1] >> (BITS_IN_NOAHZK_LIMB - 1), sign1 = rs1[width-1] >> (BITS_IN_NOAHZK_LIMB - 1);
+    NOAHZK_variable_width_mul_dispatch_scratch(dst, rs0, rs1, width, width, scratch);
+    NOAHZK_variable_width_mul_signed_fixup_primitive(dst, rs0, rs1, width, width, sign0, sign1);
+}
+
+// evaluates the 3-part polynomial src = a0 + a1*x + a2*x^2 at 1, -1 & -2, where a0, a1 are k limbs wide & a2 width_last limbs wide.
+// the results are k+1 limbs wide; those at negative points are two's complement.
+void NOAHZK_variable_width_toom3_evaluate(NOAHZK_limb_t* const p1, NOAHZK_limb_t* const pm1, NOAHZK_limb_t* const pm2, const NOAHZK_limb_t* const src, const size_t k, const size_t width_last){
+    const size_t width_eval = k + 1;
+    const NOAHZK_limb_t* const a0 = src, *const a1 = src + k, *const a2 = src + 2*k;
+
+    NOAHZK_variable_width_add_primitive(pm2, a0, a2, width_eval, k, width_last, 0, 0);          // pm2 = a0 + a2
+    NOAHZK_variable_width_add_primitive(p1, pm2, a1, width_eval, width_eval, k, 0, 0);          // p1 = a0 + a1 + a2
+    NOAHZK_variable_width_sub_primitive(pm1, pm2, a1, width_eval, width_eval, k, 0, 0);         // pm1 = a0 - a1 + a2
+    NOAHZK_variable_width_add_primitive(pm2, pm1, a2, width_eval, width_eval, width_last, 0, 0);// pm2 = a0 - a1 + 2a2
+    NOAHZK_variable_width_horner_step_primitive(pm2, 2, a0, width_eval, 0);                     // pm2 = 2a0 - 2a1 + 4a2
+    NOAHZK_variable_width_sub_primitive(pm2, pm2, a0, width_eval, width_eval, k, 0, 0);         // pm2 = a0 - 2a1 + 4a2
+}
+
+// Bodrato's interpolation for Toom-3: r0 = dst[0, 2k) and r4 = dst[4k, width_dst) are already in place,
+// r1, rm1, rm2 are the values at 1, -1, -2, 2k+2 limbs wide, two's complement. they get overwritten.
+// dst ends up holding the product. takes 2k+2 limbs of scratch.
+void NOAHZK_variable_width_toom3_interpolate(NOAHZK_limb_t* const dst, NOAHZK_limb_t* const r1, NOAHZK_limb_t* const rm1, NOAHZK_limb_t* const rm2, const size_t k, const size_t width_dst, NOAHZK_limb_t* const scratch){
+    const size_t width_r = 2*(k + 1), width_r0 = 2*k, width_r4 = width_dst - 4*k;
+    const NOAHZK_limb_t* const r0 = dst, *const r4 = dst + 4*k;
+    NOAHZK_limb_t* const r3 = rm2;
+    NOAHZK_limb_t* const r2 = scratch;
+
+    NOAHZK_variable_width_sub_primitive(r3, rm2, r1, width_r, width_r, width_r, 0, 0);             // r3 = (r(-2) - r(1))/3
+    NOAHZK_variable_width_divexact_by_limb_primitive(r3, r3, 3, width_r);
+    NOAHZK_variable_width_sub_primitive(r1, r1, rm1, width_r, width_r, width_r, 0, 0);             // r1 = (r(1) - r(-1))/2
+    NOAHZK_variable_width_shift_right_signed_small_primitive(r1, width_r, 1);
+    NOAHZK_variable_width_sub_primitive(r2, rm1, r0, width_r, width_r, width_r0, 0, 0);            // r2 = r(-1) - r0
+    NOAHZK_variable_width_sub_primitive(r3, r2, r3, width_r, width_r, width_r, 0, 0);              // r3 = (r2 - r3)/2 + 2r4
+    NOAHZK_variable_width_shift_right_signed_small_primitive(r3, width_r, 1);
+    NOAHZK_variable_width_add_primitive(r3, r3, r4, width_r, width_r, width_r4, 0, 0);
+    NOAHZK_variable_width_add_primitive(r3, r3, r4, width_r, width_r, width_r4, 0, 0);
+    NOAHZK_variable_width_add_primitive(r2, r2, r1, width_r, width_r, width_r, 0, 0);              // r2 = r2 + r1 - r4
+    NOAHZK_variable_width_sub_primitive(r2, r2, r4, width_r, width_r, width_r4, 0, 0);
+    NOAHZK_variable_width_sub_primitive(r1, r1, r3, width_r, width_r, width_r, 0, 0);              // r1 = r1 - r3
+
+// the coefficients are all nonnegative now; whatever doesn't fit in dst is 0
+    memset(dst + 2*k, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(2*k));
+    NOAHZK_variable_width_add_primitive(dst + k, dst + k, r1, width_dst - k, width_dst - k, width_r, 0, 0);
+    NOAHZK_variable_width_add_primitive(dst + 2*k, dst + 2*k, r2, width_dst - 2*k, width_dst - 2*k, width_r, 0, 0);
+    NOAHZK_variable_width_add_primitive(dst + 3*k, dst + 3*k, r3, width_dst - 3*k, width_dst - 3*k, width_r, 0, 0);
+}
+
+// Toom-3: splits both operands into 3 parts of k = ceil(width0/3) limbs, evaluates them at 0, 1, -1, -2 & infinity,
+// multiplies pointwise & interpolates with Bodrato's sequence; 5 multiplications of k+1 limbs instead of 9 of k.
+// every division in the interpolation is exact, so it's a multiplication by an inverse or a shift; constant-time 
+// requires width0 >= width1 > 2*k. dst may not alias either source. takes 12*(k+1) limbs of scratch for itself.
+void NOAHZK_variable_width_mul_toom3(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, NOAHZK_limb_t* const scratch){
+    const size_t k = (width0 + 2)/3;
+    const size_t width_last0 = width0 - 2*k, width_last1 = width1 - 2*k;
+    const size_t width_dst = width0 + width1, width_eval = k + 1, width_r = 2*width_eval;
+
+    NOAHZK_limb_t* const p1 = scratch, *const pm1 = p1 + width_eval, *const pm2 = pm1 + width_eval;
+    NOAHZK_limb_t* const q1 = pm2 + width_eval, *const qm1 = q1 + width_eval, *const qm2 = qm1 + width_eval;
+    NOAHZK_variable_width_toom3_evaluate(p1, pm1, pm2, rs0, k, width_last0);
+    NOAHZK_variable_width_toom3_evaluate(q1, qm1, qm2, rs1, k, width_last1);
+
+    NOAHZK_limb_t* const r1 = qm2 + width_eval, *const rm1 = r1 + width_r, *const rm2 = rm1 + width_r, *const scratch_children = rm2 + width_r;
+    NOAHZK_variable_width_mul_dispatch_scratch(dst, rs0, rs1, k, k, scratch_children);
+    NOAHZK_variable_width_mul_dispatch_scratch(dst + 4*k, rs0 + 2*k, rs1 + 2*k, width_last0, width_last1, scratch_children);
+    NOAHZK_variable_width_mul_dispatch_scratch(r1, p1, q1, width_eval, width_eval, scratch_children);
+    NOAHZK_variable_width_mul_signed_arr(rm1, pm1, qm1, width_eval, scratch_children);
+    NOAHZK_variable_width_mul_signed_arr(rm2, pm2, qm2, width_eval, scratch_children);
+
+    NOAHZK_variable_width_toom3_interpolate(dst, r1, rm1, rm2, k, width_dst, scratch_children);
+}
+
+// evaluates the 4-part polynomial src = a0 + a1*x + a2*x^2 + a3*x^3 at 1, -1, 2, -2 & (1/2 times 2^3),
+// where a0, a1, a2 are k limbs wide & a3 width_last limbs wide.
+// the results are k+1 limbs wide; those at negative points are two's complement. takes 2k+2 limbs of scratch.
+void NOAHZK_variable_width_toom4_evaluate(NOAHZK_limb_t* const p1, NOAHZK_limb_t* const pm1, NOAHZK_limb_t* const p2, NOAHZK_limb_t* const pm2, NOAHZK_limb_t* const ph, const NOAHZK_limb_t* const src, const size_t k, const size_t width_last, NOAHZK_limb_t* const scratch){
+    const size_t width_eval = k + 1;
+    const NOAHZK_limb_t* const a0 = src, *const a1 = src + k, *const a2 = src + 2*k, *const a3 = src + 3*k;
+    NOAHZK_limb_t* const even = scratch, *const odd = scratch + width_eval;
+
+    NOAHZK_variable_width_add_primitive(even, a0, a2, width_eval, k, k, 0, 0);                 // even = a0 + a2
+    NOAHZK_variable_width_add_primitive(odd, a1, a3, width_eval, k, width_last, 0, 0);         // odd = a1 + a3
+    NOAHZK_variable_width_add_primitive(p1, even, odd, width_eval, width_eval, width_eval, 0, 0);
+    NOAHZK_variable_width_sub_primitive(pm1, even, odd, width_eval, width_eval, width_eval, 0, 0);
+
+    memset(even, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_eval));                     // even = a0 + 4a2
+    NOAHZK_variable_width_horner_step_primitive(even, 4, a2, width_eval, k);
+    NOAHZK_variable_width_horner_step_primitive(even, 4, a0, width_eval, k);
+    memset(odd, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_eval));                      // odd = 2a1 + 8a3
+    NOAHZK_variable_width_horner_step_primitive(odd, 4, a3, width_eval, width_last);
+    NOAHZK_variable_width_horner_step_primitive(odd, 4, a1, width_eval, k);
+    NOAHZK_variable_width_mul_arr_with_limb(odd, odd, 2, width_eval);
+    NOAHZK_variable_width_add_primitive(p2, even, odd, width_eval, width_eval, width_eval, 0, 0);
+    NOAHZK_variable_width_sub_primitive(pm2, even, odd, width_eval, width_eval, width_eval, 0, 0);
+
+    memset(ph, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_eval));                       // ph = 8a0 + 4a1 + 2a2 + a3
+    NOAHZK_variable_width_horner_step_primitive(ph, 2, a0, width_eval, k);
+    NOAHZK_variable_width_horner_step_primitive(ph, 2, a1, width_eval, k);
+    NOAHZK_variable_width_horner_step_primitive(ph, 2, a2, width_eval, k);
+    NOAHZK_variable_width_horner_step_primitive(ph, 2, a3, width_eval, width_last);
+}
+
+// interpolation for Toom-4: c0 = dst[0, 2k) and c6 = dst[6k, width_dst) are already in place,
+// r1, rm1, r2, rm2, rh are the values at 1, -1, 2, -2 & 1/2 (times 2^6), 2k+2 limbs wide, two's complement. they get overwritten.
+// solves for the even coefficients c2, c4 first, then for the odd ones c1, c3, c5; dst ends up holding the product.
+void NOAHZK_variable_width_toom4_interpolate(NOAHZK_limb_t* const dst, NOAHZK_limb_t* const r1, NOAHZK_limb_t* const rm1, NOAHZK_limb_t* const r2, NOAHZK_limb_t* const rm2, NOAHZK_limb_t* const rh, const size_t k, const size_t width_dst){
+    const size_t width_r = 2*(k + 1), width_c0 = 2*k, width_c6 = width_dst - 6*k;
+    const NOAHZK_limb_t* const c0 = dst, *const c6 = dst + 6*k;
+
+    NOAHZK_variable_width_sub_primitive(rm1, r1, rm1, width_r, width_r, width_r, 0, 0);            // rm1 = O1 = (r(1) - r(-1))/2 = c1 + c3 + c5
+    NOAHZK_variable_width_shift_right_signed_small_primitive(rm1, width_r, 1);
+    NOAHZK_variable_width_sub_primitive(r1, r1, rm1, width_r, width_r, width_r, 0, 0);             // r1 = E1 = r(1) - O1 = c0 + c2 + c4 + c6
+    NOAHZK_variable_width_sub_primitive(rm2, r2, rm2, width_r, width_r, width_r, 0, 0);            // rm2 = O2 = (r(2) - r(-2))/4 = c1 + 4c3 + 16c5
+    NOAHZK_variable_width_shift_right_signed_small_primitive(rm2, width_r, 2);
+    NOAHZK_variable_width_submul_primitive(r2, rm2, 2, width_r, width_r);                          // r2 = E2 = r(2) - 2*O2 = c0 + 4c2 + 16c4 + 64c6
+
+    NOAHZK_variable_width_sub_primitive(r1, r1, c0, width_r, width_r, width_c0, 0, 0);             // r1 = c2 + c4
+    NOAHZK_variable_width_sub_primitive(r1, r1, c6, width_r, width_r, width_c6, 0, 0);
+    NOAHZK_variable_width_sub_primitive(r2, r2, c0, width_r, width_r, width_c0, 0, 0);             // r2 = c2 + 4c4
+    NOAHZK_variable_width_submul_primitive(r2, c6, 64, width_r, width_c6);
+    NOAHZK_variable_width_shift_right_signed_small_primitive(r2, width_r, 2);
+    NOAHZK_variable_width_sub_primitive(r2, r2, r1, width_r, width_r, width_r, 0, 0);              // r2 = c4
+    NOAHZK_variable_width_divexact_by_limb_primitive(r2, r2, 3, width_r);
+    NOAHZK_variable_width_sub_primitive(r1, r1, r2, width_r, width_r, width_r, 0, 0);              // r1 = c2
+
+    NOAHZK_variable_width_submul_primitive(rh, c0, 64, width_r, width_c0);                         // rh = O3 = 16c1 + 4c3 + c5
+    NOAHZK_variable_width_submul_primitive(rh, r1, 16, width_r, width_r);
+    NOAHZK_variable_width_submul_primitive(rh, r2, 4, width_r, width_r);
+    NOAHZK_variable_width_sub_primitive(rh, rh, c6, width_r, width_r, width_c6, 0, 0);
+    NOAHZK_variable_width_shift_right_signed_small_primitive(rh, width_r, 1);
+
+    NOAHZK_variable_width_sub_primitive(rm2, rm2, rm1, width_r, width_r, width_r, 0, 0);           // rm2 = (O2 - O1)/3 = c3 + 5c5
+    NOAHZK_variable_width_divexact_by_limb_primitive(rm2, rm2, 3, width_r);
+    NOAHZK_variable_width_submul_primitive(rh, rm1, 16, width_r, width_r);                         // rh = (O3 - 16*O1)/3 = -4c3 - 5c5
+    NOAHZK_variable_width_divexact_by_limb_primitive(rh, rh, 3, width_r);
+    NOAHZK_variable_width_add_primitive(rh, rh, rm2, width_r, width_r, width_r, 0, 0);             // rh = c3
+    NOAHZK_variable_width_divexact_by_limb_primitive(rh, rh, 3, width_r);
+    NOAHZK_variable_width_negate_conditionally_primitive(rh, rh, width_r, 1);
+    NOAHZK_variable_width_sub_primitive(rm2, rm2, rh, width_r, width_r, width_r, 0, 0);            // rm2 = c5
+    NOAHZK_variable_width_divexact_by_limb_primitive(rm2, rm2, 5, width_r);
+    NOAHZK_variable_width_sub_primitive(rm1, rm1, rh, width_r, width_r, width_r, 0, 0);            // rm1 = c1
+    NOAHZK_variable_width_sub_primitive(rm1, rm1, rm2, width_r, width_r, width_r, 0, 0);
+
+// the coefficients are all nonnegative now; whatever doesn't fit in dst is 0
+    memset(dst + 2*k, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(4*k));
+    NOAHZK_variable_width_add_primitive(dst + k, dst + k, rm1, width_dst - k, width_dst - k, width_r, 0, 0);
+    NOAHZK_variable_width_add_primitive(dst + 2*k, dst + 2*k, r1, width_dst - 2*k, width_dst - 2*k, width_r, 0, 0);
+    NOAHZK_variable_width_add_primitive(dst + 3*k, dst + 3*k, rh, width_dst - 3*k, width_dst - 3*k, width_r, 0, 0);
+    NOAHZK_variable_width_add_primitive(dst + 4*k, dst + 4*k, r2, width_dst - 4*k, width_dst - 4*k, width_r, 0, 0);
+    NOAHZK_variable_width_add_primitive(dst + 5*k, dst + 5*k, rm2, width_dst - 5*k, width_dst - 5*k, width_r, 0, 0);
+}
+
+// Toom-4: splits both operands into 4 parts of k = ceil(width0/4) limbs, evaluates them at 0, 1, -1, 2, -2, 1/2 & infinity,
+// multiplies pointwise & interpolates; 7 multiplications of k+1 limbs instead of 16 of k.
+// every division in it is exact, so it's a multiplication by an inverse or a shift; constant-time 
+// requires width0 >= width1 > 3*k. dst may not alias either source. takes 20*(k+1) limbs of scratch for itself.
+void NOAHZK_variable_width_mul_toom4(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, NOAHZK_limb_t* const scratch){
+    const size_t k = (width0 + 3)/4;
+    const size_t width_last0 = width0 - 3*k, width_last1 = width1 - 3*k;
+    const size_t width_dst = width0 + width1, width_eval = k + 1, width_r = 2*width_eval;
+
+    NOAHZK_limb_t* const p1 = scratch, *const pm1 = p1 + width_eval, *const p2 = pm1 + width_eval, *const pm2 = p2 + width_eval, *const ph = pm2 + width_eval;
+    NOAHZK_limb_t* const q1 = ph + width_eval, *const qm1 = q1 + width_eval, *const q2 = qm1 + width_eval, *const qm2 = q2 + width_eval, *const qh = qm2 + width_eval;
+    NOAHZK_limb_t* const r1 = qh + width_eval, *const rm1 = r1 + width_r, *const r2 = rm1 + width_r, *const rm2 = r2 + width_r, *const rh = rm2 + width_r;
+    NOAHZK_limb_t* const scratch_children = rh + width_r;
+    NOAHZK_variable_width_toom4_evaluate(p1, pm1, p2, pm2, ph, rs0, k, width_last0, scratch_children);
+    NOAHZK_variable_width_toom4_evaluate(q1, qm1, q2, qm2, qh, rs1, k, width_last1, scratch_children);
+
+    NOAHZK_variable_width_mul_dispatch_scratch(dst, rs0, rs1, k, k, scratch_children);
+    NOAHZK_variable_width_mul_dispatch_scratch(dst + 6*k, rs0 + 3*k, rs1 + 3*k, width_last0, width_last1, scratch_children);
+    NOAHZK_variable_width_mul_dispatch_scratch(r1, p1, q1, width_eval, width_eval, scratch_children);
+    NOAHZK_variable_width_mul_signed_arr(rm1, pm1, qm1, width_eval, scratch_children);
+    NOAHZK_variable_width_mul_dispatch_scratch(r2, p2, q2, width_eval, width_eval, scratch_children);
+    NOAHZK_variable_width_mul_signed_arr(rm2, pm2, qm2, width_eval, scratch_children);
+    NOAHZK_variable_width_mul_dispatch_scratch(rh, ph, qh, width_eval, width_eval, scratch_children);
+
+    NOAHZK_variable_width_toom4_interpolate(dst, r1, rm1, r2, rm2, rh, k, width_dst);
+}
+
+// dst = rs0*rs1, writing all width0 + width1 limbs of dst; picks the multiplication algorithm by operand widths only, so it's constant-time.
+// dst may not alias either source. scratch has to be NOAHZK_variable_width_mul_dispatch_scratch_size(width0, width1) limbs wide.
+void NOAHZK_variable_width_mul_dispatch_scratch(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, NOAHZK_limb_t* const scratch){
+    if(width0 < width1){ NOAHZK_variable_width_mul_dispatch_scratch(dst, rs1, rs0, width1, width0, scratch); return; }
+
+    if(width1 <= NOAHZK_MUL_KARATSUBA_THRESHOLD) NOAHZK_variable_width_mul_schoolbook(dst, rs0, rs1, width0, width1);
+    else if(width1 <= width0 - width0/2) NOAHZK_variable_width_mul_unbalanced(dst, rs0, rs1, width0, width1, scratch);
+    else if(width1 > NOAHZK_MUL_NTT_THRESHOLD && NOAHZK_variable_width_mul_ntt_fits(width0, width1)) NOAHZK_variable_width_mul_ntt_scratch(dst, rs0, rs1, width0, width1, scratch);
+    else if(width1 > NOAHZK_MUL_TOOM4_THRESHOLD && width1 > 3*((width0 + 3)/4)) NOAHZK_variable_width_mul_toom4(dst, rs0, rs1, width0, width1, scratch);
+    else if(width1 > NOAHZK_MUL_TOOM3_THRESHOLD && width1 > 2*((width0 + 2)/3)) NOAHZK_variable_width_mul_toom3(dst, rs0, rs1, width0, width1, scratch);
+    else NOAHZK_variable_width_mul_karatsuba(dst, rs0, rs1, width0, width1, scratch);
+}
+
+// limbs of scratch any multiplication in NOAHZK_variable_width_mul_dispatch_scratch needs, where the wider operand is width limbs wide.
+// every tier takes some scratch for itself, then hands the rest to products of at most ceil(width/2) + 1 limbs (one after another),
+// so following that bound down gives enough scratch for every tier that could be picked, at any depth. the bound only grows with width.
+// Karatsuba takes 4*(h+1) limbs, Toom-3 12*(k+1) & Toom-4 20*(k+1) (each plus 2*(k+1) for the interpolation).
+size_t NOAHZK_variable_width_mul_scratch_bound(size_t width){
+    size_t width_scratch = 0;
+    while(width > NOAHZK_MUL_KARATSUBA_THRESHOLD){
+        const size_t h = width - width/2;
+        size_t width_tier = 4*(h + 1);
+        if(width > NOAHZK_MUL_TOOM3_THRESHOLD) width_tier = NOAHZK_MAX(width_tier, 14*((width + 2)/3 + 1));
+        if(width > NOAHZK_MUL_TOOM4_THRESHOLD) width_tier = NOAHZK_MAX(width_tier, 22*((width + 3)/4 + 1));
+        if(width > NOAHZK_MUL_NTT_THRESHOLD) width_tier = NOAHZK_MAX(width_tier, NOAHZK_variable_width_mul_ntt_scratch_size(width, width));
+
+        width_scratch += width_tier;
+        width = h + 1;
+    }
+    return width_scratch;
+}
+
+size_t NOAHZK_variable_width_mul_dispatch_scratch_size(const size_t width0, const size_t width1){
+    if(NOAHZK_MIN(width0, width1) <= NOAHZK_MUL_KARATSUBA_THRESHOLD) return 0;
+    return NOAHZK_variable_width_mul_scratch_bound(NOAHZK_MAX(width0, width1));
+}
+
+// same as above, with scratch from the default workspace
+void NOAHZK_variable_width_mul_dispatch(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1){
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_mul_dispatch_scratch_size(width0, width1));
+    NOAHZK_variable_width_mul_dispatch_scratch(dst, rs0, rs1, width0, width1, scratch);
+}
+
+size_t NOAHZK_variable_width_mul_limb_scratch_size(const size_t width0, const size_t width1){
+    if(width0 == 0 || width1 == 0) return 0;
+    return width0 + width1 + NOAHZK_variable_width_mul_dispatch_scratch_size(width0, width1);
+}
+
+// dst = rs0*rs1 truncated (or zero-extended) to width_dst limbs; all widths in limbs.
+// dst may alias either source. scratch has to be NOAHZK_variable_width_mul_limb_scratch_size(width0, width1) limbs wide.
 // constant-time 
-// uses VLAs; I don't want to use dynamic memory allocation as it'd just be slow.
-void NOAHZK_variable_width_mul_byte(void* const dst, const void* const rs0, const void* const rs1, const size_t width0, const size_t width1, const size_t width_dst){
-// handles common cases quickly
-    if(width0 == 0 && width1 == 0) return;
-    if(width0 == 0 || width1 == 0){ memset(dst, 0, width0+width1); return; }
-    if(width0 == sizeof(uint8_t) && width1 == sizeof(uint8_t)){
-        *(uint16_t*)dst = (uint16_t)( *(uint8_t*)rs0 ) * (uint16_t)( *(uint8_t*)rs1 ); 
+void NOAHZK_variable_width_mul_limb_scratch(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, const size_t width_dst, NOAHZK_limb_t* const scratch){
+    if(width0 == 0 || width1 == 0){ memset(dst, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_dst)); return; }
+
+    const size_t width_product = width0 + width1;
+    NOAHZK_limb_t* const product = scratch;
+    NOAHZK_variable_width_mul_dispatch_scratch(product, rs0, rs1, width0, width1, scratch + width_product);
+// HAS to be done at the end because, if we do this at the start and dst == rs0, then we'd be overwriting rs0, which is bad.
+    const size_t width_copied = NOAHZK_MIN(width_dst, width_product);
+    memcpy(dst, product, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_copied));
+    memset(dst + width_copied, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_dst - width_copied));
+}
+
+void NOAHZK_variable_width_mul_limb(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, const size_t width_dst){
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_mul_limb_scratch_size(width0, width1));
+    NOAHZK_variable_width_mul_limb_scratch(dst, rs0, rs1, width0, width1, width_dst, scratch);
+}
+
+// dst = src, or -src if op is 1, truncated or sign-extended to width_dst limbs: the product of src & a unit, which the _vartime kernels
+// store instead of multiplying. dst may alias src.
+void NOAHZK_variable_width_store_unit_product_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const size_t width_src, const NOAHZK_limb_t sign_src, const size_t width_dst, NOAHZK_op_t op){
+    NOAHZK_limb_t carry = op;
+    for(size_t i = 0; i < width_dst; i++){
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)NOAHZK_variable_width_conditionally_invert(NOAHZK_variable_width_get_arr(src, width_src, sign_src, i), op) + carry;
+        dst[i] = z & NOAHZK_LIMB_MAX;
+        carry = NOAHZK_variable_width_get_out(z);
+    }
+}
+
+// not constant-time; for public operands only.
+// same as NOAHZK_variable_width_mul_limb, but leading zero limbs of the operands are skipped, so the algorithm (& NTT size) is picked by the values' actual widths,
+// & products by 0 or 1 aren't multiplied at all. takes as much scratch as NOAHZK_variable_width_mul_limb_scratch would for the untrimmed widths.
+void NOAHZK_variable_width_mul_limb_vartime_scratch(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, size_t width0, size_t width1, const size_t width_dst, NOAHZK_limb_t* const scratch){
+    width0 = NOAHZK_variable_width_significant_width_vartime(rs0, width0, 0);
+    width1 = NOAHZK_variable_width_significant_width_vartime(rs1, width1, 0);
+    if(width0 == 1 && rs0[0] == 1) NOAHZK_variable_width_store_unit_product_primitive(dst, rs1, width1, 0, width_dst, 0);
+    else if(width1 == 1 && rs1[0] == 1) NOAHZK_variable_width_store_unit_product_primitive(dst, rs0, width0, 0, width_dst, 0);
+    else NOAHZK_variable_width_mul_limb_scratch(dst, rs0, rs1, width0, width1, width_dst, scratch);
+}
+
+void NOAHZK_variable_width_mul_limb_vartime(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, const size_t width_dst){
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_mul_limb_scratch_size(width0, width1));
+    NOAHZK_variable_width_mul_limb_vartime_scratch(dst, rs0, rs1, width0, width1, width_dst, scratch);
+}
+
+void NOAHZK_variable_width_mul_limb_timed_scratch(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, const size_t width_dst, const NOAHZK_variable_width_timing_t timing, NOAHZK_limb_t* const scratch){
+    if(timing == NOAHZK_variable_width_variable_time) NOAHZK_variable_width_mul_limb_vartime_scratch(dst, rs0, rs1, width0, width1, width_dst, scratch);
+    else NOAHZK_variable_width_mul_limb_scratch(dst, rs0, rs1, width0, width1, width_dst, scratch);
+}
+
+void NOAHZK_variable_width_mul_limb_timed(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, const size_t width_dst, const NOAHZK_variable_width_timing_t timing){
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_mul_limb_scratch_size(width0, width1));
+    NOAHZK_variable_width_mul_limb_timed_scratch(dst, rs0, rs1, width0, width1, width_dst, timing, scratch);
+}
+
+// dst = product, a two's complement array of width_product limbs, truncated or sign-extended to width_dst limbs.
+// the store stage of the signed kernels below; dst may alias anything product was computed from.
+void NOAHZK_variable_width_store_signed_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const product, const size_t width_product, const size_t width_dst){
+    const NOAHZK_limb_t extension = -(product[width_product - 1] >> (BITS_IN_NOAHZK_LIMB - 1));
+    for(size_t i = 0; i < width_dst; i++) dst[i] = i < width_product? product[i]: extension;
+}
+
+// not constant-time; for public operands only.
+// the widths the _vartime signed multiplications cut rs0 & rs1 down to: their significant widths (see NOAHZK_variable_width_significant_width_vartime),
+// whose product is then exactly as wide as their sum. the exception is an operand that's negative but has its top bit clear: it can be
+// as low as -B^width0, & the product needs every limb of both operands, so neither is cut down.
+void NOAHZK_variable_width_mul_widths_vartime(size_t* const width_mul0, size_t* const width_mul1, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, const NOAHZK_limb_t sign0, const NOAHZK_limb_t sign1){
+    const int below0 = sign0 && width0 && !(rs0[width0 - 1] >> (BITS_IN_NOAHZK_LIMB - 1));
+    const int below1 = sign1 && width1 && !(rs1[width1 - 1] >> (BITS_IN_NOAHZK_LIMB - 1));
+    *width_mul0 = below0 || below1? width0: NOAHZK_variable_width_significant_width_vartime(rs0, width0, sign0);
+    *width_mul1 = below0 || below1? width1: NOAHZK_variable_width_significant_width_vartime(rs1, width1, sign1);
+}
+
+// dst = rs0*rs1 truncated or sign-extended to width_dst limbs, where rs0 & rs1 are two's complement arrays whose signs are sign0 & sign1.
+// single-pass signed multiplication: the operands go into the kernels as they are instead of being negated into copies first,
+// the product is fixed up by NOAHZK_variable_width_mul_signed_fixup_primitive & stored sign-extended, so the result is never negated either.
+// dst may alias either source. scratch has to be NOAHZK_variable_width_mul_limb_scratch_size(width0, width1) limbs wide.
+// constant-time, unless timing is NOAHZK_variable_width_variable_time; then the operands are cut down to the widths
+// NOAHZK_variable_width_mul_widths_vartime gives, & products by 0 or +-1 aren't multiplied at all.
+void NOAHZK_variable_width_mul_signed_limb_timed_scratch(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, size_t width0, size_t width1, const NOAHZK_limb_t sign0, const NOAHZK_limb_t sign1, const size_t width_dst, const NOAHZK_variable_width_timing_t timing, NOAHZK_limb_t* const scratch){
+    if(timing == NOAHZK_variable_width_variable_time){
+        NOAHZK_variable_width_mul_widths_vartime(&width0, &width1, rs0, rs1, width0, width1, sign0, sign1);
+        if(width0 == 1 && rs0[0] == (sign0? NOAHZK_LIMB_MAX: 1)){ NOAHZK_variable_width_store_unit_product_primitive(dst, rs1, width1, sign1, width_dst, sign0); return; }
+        if(width1 == 1 && rs1[0] == (sign1? NOAHZK_LIMB_MAX: 1)){ NOAHZK_variable_width_store_unit_product_primitive(dst, rs0, width0, sign0, width_dst, sign1); return; }
+    }
+// dst may be NULL when width_dst is 0, so memset can't be handed it even to clear nothing
+    if(width0 == 0 || width1 == 0){
+        if(width_dst) memset(dst, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_dst));
         return;
     }
-    if(width0 == sizeof(uint8_t)){ NOAHZK_variable_width_mul_arr_with_byte(dst, rs1, *(uint8_t*)rs0, width1); return; }
-    if(width1 == sizeof(uint8_t)){ NOAHZK_variable_width_mul_arr_with_byte(dst, rs0, *(uint8_t*)rs1, width0); return; }
-/*
-// consider adding these in the future
-    if(width0 == sizeof(uint16_t) && width1 == sizeof(uint16_t)){ *(uint32_t*)dst = (uint32_t)( *(uint16_t*)rs0 ) * (uint32_t)( *(uint16_t*)rs1 ); return; }
-    if(width0 == sizeof(uint32_t) && width1 == sizeof(uint32_t)){ *(uint64_t*)dst = (uint64_t)( *(uint32_t*)rs0 ) * (uint64_t)( *(uint32_t*)rs1 ); return; }
-*/
 
-    const size_t n = width0/2, m = width1/2;
-
-    const size_t width_X1Y1 = width0-n + width1-m;
-    uint8_t X1Y1[width_X1Y1];
-    NOAHZK_variable_width_mul_byte(X1Y1, (uint8_t*)rs0 + n, (uint8_t*)rs1 + m, width0-n, width1-m, width_X1Y1);
-
-    const size_t width_X1Y0 = width0-n + m;
-    uint8_t X1Y0[width_X1Y0];
-    NOAHZK_variable_width_mul_byte(X1Y0, (uint8_t*)rs0 + n, rs1, width0-n, m, width_X1Y0);
-    
-    const size_t width_X0Y1 = n + width1-m;
-    uint8_t X0Y1[width_X0Y1];
-    NOAHZK_variable_width_mul_byte(X0Y1, rs0, (uint8_t*)rs1 + m, n, width1-m, width_X0Y1);
-    
-    const size_t width_X0Y0 = n + m;
-    uint8_t X0Y0[width_X0Y0];
-    NOAHZK_variable_width_mul_byte(X0Y0, rs0, rs1, n, m, width_X0Y0);
-// HAS to be done at the end because, if we do this at the start and dst == rs0, then we'd be setting rs0 to 0, which is bad.
-    memset(dst, 0, width_dst);
-    NOAHZK_variable_width_add_with_byte_offset_byte(dst, X0Y0, X0Y1, width_X0Y0, width_X0Y1, width_dst, m);
-    NOAHZK_variable_width_add_with_byte_offset_byte(dst, dst,  X1Y0, width_dst,  width_X1Y0, width_dst, n);
-    NOAHZK_variable_width_add_with_byte_offset_byte(dst, dst,  X1Y1, width_dst,  width_X1Y1, width_dst, n+m);
+    const size_t width_product = width0 + width1;
+    NOAHZK_limb_t* const product = scratch;
+    NOAHZK_variable_width_mul_dispatch_scratch(product, rs0, rs1, width0, width1, scratch + width_product);
+
+    NOAHZK_variable_width_mul_signed_fixup_primitive(product, rs0, rs1, width0, width1, sign0, sign1);
+// HAS to be done at the end, for the same reason as in NOAHZK_variable_width_mul_limb_scratch
+    NOAHZK_variable_width_store_signed_primitive(dst, product, width_product, width_dst);
+}
+
+void NOAHZK_variable_width_mul_signed_limb_scratch(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, const NOAHZK_limb_t sign0, const NOAHZK_limb_t sign1, const size_t width_dst, NOAHZK_limb_t* const scratch){
+    NOAHZK_variable_width_mul_signed_limb_timed_scratch(dst, rs0, rs1, width0, width1, sign0, sign1, width_dst, NOAHZK_variable_width_constant_time, scratch);
+}
+
+void NOAHZK_variable_width_mul_signed_limb(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, const NOAHZK_limb_t sign0, const NOAHZK_limb_t sign1, const size_t width_dst){
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_mul_limb_scratch_size(width0, width1));
+    NOAHZK_variable_width_mul_signed_limb_scratch(dst, rs0, rs1, width0, width1, sign0, sign1, width_dst, scratch);
+}
+
+// squaring: every tier below computes src^2 with the cross products a_i*a_j (i != j) only once.
+
+// dst = src^2, writing all 2*width limbs of dst. width has to be nonzero.
+// the cross products are summed once over the upper triangle, doubled, then the diagonal squares are added in.
+// dst may not alias src.
+void NOAHZK_variable_width_sqr_schoolbook(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const src, const size_t width){
+    dst[0] = 0;
+    dst[width] = NOAHZK_variable_width_mul_arr_with_limb(dst + 1, src + 1, src[0], width - 1);
+    for(size_t i = 1; i + 1 < width; i++) dst[width + i] = NOAHZK_variable_width_addmul_arr_with_limb(dst + 2*i + 1, src + i + 1, src[i], width - i - 1);
+    dst[2*width - 1] = 0;
+
+    NOAHZK_variable_width_add_primitive(dst, dst, dst, 2*width, 2*width, 2*width, 0, 0);
+
+    NOAHZK_limb_t carry = 0;
+    for(size_t i = 0; i < width; i++){
+        const NOAHZK_expanded_limb_t square = (NOAHZK_expanded_limb_t)src[i] * (NOAHZK_expanded_limb_t)src[i];
+        const NOAHZK_expanded_limb_t z0 = (NOAHZK_expanded_limb_t)dst[2*i] + (square & NOAHZK_LIMB_MAX) + carry;
+        dst[2*i] = z0 & NOAHZK_LIMB_MAX;
+        const NOAHZK_expanded_limb_t z1 = (NOAHZK_expanded_limb_t)dst[2*i + 1] + (square >> BITS_IN_NOAHZK_LIMB) + NOAHZK_variable_width_get_out(z0);
+        dst[2*i + 1] = z1 & NOAHZK_LIMB_MAX;
+        carry = NOAHZK_variable_width_get_out(z1);
+    }
+}
+
+void NOAHZK_variable_width_sqr_dispatch_scratch(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const src, const size_t width, NOAHZK_limb_t* const scratch);
+
+// 3-square Karatsuba: (X1*B^h + X0)^2 = X1^2*B^2h + ((X0 + X1)^2 - X1^2 - X0^2)*B^h + X0^2, with h = ceil(width/2).
+// requires width > NOAHZK_MUL_KARATSUBA_THRESHOLD. dst may not alias src. takes 3*(h+1) limbs of scratch for itself.
+void NOAHZK_variable_width_sqr_karatsuba(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const src, const size_t width, NOAHZK_limb_t* const scratch){
+    const size_t h = width - width/2;
+    const size_t width_dst = 2*width, width_sum = h + 1, width_middle = 2*width_sum;
+    NOAHZK_limb_t* const sum = scratch, *const middle = sum + width_sum, *const scratch_children = middle + width_middle;
+
+    NOAHZK_variable_width_sqr_dispatch_scratch(dst, src, h, scratch_children);
+    NOAHZK_variable_width_sqr_dispatch_scratch(dst + 2*h, src + h, width - h, scratch_children);
+
+    NOAHZK_variable_width_add_primitive(sum, src, src + h, width_sum, h, width - h, 0, 0);
+    NOAHZK_variable_width_sqr_dispatch_scratch(middle, sum, width_sum, scratch_children);
+
+    NOAHZK_variable_width_sub_primitive(middle, middle, dst, width_middle, width_middle, 2*h, 0, 0);
+    NOAHZK_variable_width_sub_primitive(middle, middle, dst + 2*h, width_middle, width_middle, width_dst - 2*h, 0, 0);
+    NOAHZK_variable_width_add_primitive(dst + h, dst + h, middle, width_dst - h, width_dst - h, width_middle, 0, 0);
+}
+
+// dst = src^2 over 2*width limbs, where src is a two's complement array of width limbs.
+// src is squared as it is & fixed up the same way as NOAHZK_variable_width_mul_signed_arr.
+void NOAHZK_variable_width_sqr_signed_arr(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const src, const size_t width, NOAHZK_limb_t* const scratch){
+    const NOAHZK_limb_t sign = src[width-1] >> (BITS_IN_NOAHZK_LIMB - 1);
+    NOAHZK_variable_width_sqr_dispatch_scratch(dst, src, width, scratch);
+    NOAHZK_variable_width_mul_signed_fixup_primitive(dst, src, src, width, width, sign, sign);
+}
+
+// Toom-3 squaring: one evaluation & 5 squares of k+1 limbs. requires width > 2*k, where k = ceil(width/3). dst may not alias src.
+// takes 9*(k+1) limbs of scratch for itself.
+void NOAHZK_variable_width_sqr_toom3(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const src, const size_t width, NOAHZK_limb_t* const scratch){
+    const size_t k = (width + 2)/3;
+    const size_t width_eval = k + 1, width_r = 2*width_eval;
+
+    NOAHZK_limb_t* const p1 = scratch, *const pm1 = p1 + width_eval, *const pm2 = pm1 + width_eval;
+    NOAHZK_variable_width_toom3_evaluate(p1, pm1, pm2, src, k, width - 2*k);
+
+    NOAHZK_limb_t* const r1 = pm2 + width_eval, *const rm1 = r1 + width_r, *const rm2 = rm1 + width_r, *const scratch_children = rm2 + width_r;
+    NOAHZK_variable_width_sqr_dispatch_scratch(dst, src, k, scratch_children);
+    NOAHZK_variable_width_sqr_dispatch_scratch(dst + 4*k, src + 2*k, width - 2*k, scratch_children);
+    NOAHZK_variable_width_sqr_dispatch_scratch(r1, p1, width_eval, scratch_children);
+    NOAHZK_variable_width_sqr_signed_arr(rm1, pm1, width_eval, scratch_children);
+    NOAHZK_variable_width_sqr_signed_arr(rm2, pm2, width_eval, scratch_children);
+
+    NOAHZK_variable_width_toom3_interpolate(dst, r1, rm1, rm2, k, 2*width, scratch_children);
+}
+
+// Toom-4 squaring: one evaluation & 7 squares of k+1 limbs. requires width > 3*k, where k = ceil(width/4). dst may not alias src.
+// takes 15*(k+1) limbs of scratch for itself.
+void NOAHZK_variable_width_sqr_toom4(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const src, const size_t width, NOAHZK_limb_t* const scratch){
+    const size_t k = (width + 3)/4;
+    const size_t width_eval = k + 1, width_r = 2*width_eval;
+
+    NOAHZK_limb_t* const p1 = scratch, *const pm1 = p1 + width_eval, *const p2 = pm1 + width_eval, *const pm2 = p2 + width_eval, *const ph = pm2 + width_eval;
+    NOAHZK_limb_t* const r1 = ph + width_eval, *const rm1 = r1 + width_r, *const r2 = rm1 + width_r, *const rm2 = r2 + width_r, *const rh = rm2 + width_r;
+    NOAHZK_limb_t* const scratch_children = rh + width_r;
+    NOAHZK_variable_width_toom4_evaluate(p1, pm1, p2, pm2, ph, src, k, width - 3*k, scratch_children);
+
+    NOAHZK_variable_width_sqr_dispatch_scratch(dst, src, k, scratch_children);
+    NOAHZK_variable_width_sqr_dispatch_scratch(dst + 6*k, src + 3*k, width - 3*k, scratch_children);
+    NOAHZK_variable_width_sqr_dispatch_scratch(r1, p1, width_eval, scratch_children);
+    NOAHZK_variable_width_sqr_signed_arr(rm1, pm1, width_eval, scratch_children);
+    NOAHZK_variable_width_sqr_dispatch_scratch(r2, p2, width_eval, scratch_children);
+    NOAHZK_variable_width_sqr_signed_arr(rm2, pm2, width_eval, scratch_children);
+    NOAHZK_variable_width_sqr_dispatch_scratch(rh, ph, width_eval, scratch_children);
+
+    NOAHZK_variable_width_toom4_interpolate(dst, r1, rm1, r2, rm2, rh, k, 2*width);
+}
+
+// dst = src^2, writing all 2*width limbs of dst; picks the algorithm by width only, so it's constant-time.
+// dst may not alias src. scratch has to be NOAHZK_variable_width_sqr_dispatch_scratch_size(width) limbs wide.
+void NOAHZK_variable_width_sqr_dispatch_scratch(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const src, const size_t width, NOAHZK_limb_t* const scratch){
+    if(width <= NOAHZK_SQR_KARATSUBA_THRESHOLD) NOAHZK_variable_width_sqr_schoolbook(dst, src, width);
+    else if(width > NOAHZK_MUL_NTT_THRESHOLD && NOAHZK_variable_width_mul_ntt_fits(width, width)) NOAHZK_variable_width_mul_ntt_scratch(dst, src, src, width, width, scratch);
+    else if(width > NOAHZK_SQR_TOOM4_THRESHOLD && width > 3*((width + 3)/4)) NOAHZK_variable_width_sqr_toom4(dst, src, width, scratch);
+    else if(width > NOAHZK_SQR_TOOM3_THRESHOLD && width > 2*((width + 2)/3)) NOAHZK_variable_width_sqr_toom3(dst, src, width, scratch);
+    else NOAHZK_variable_width_sqr_karatsuba(dst, src, width, scratch);
+}
+
+// limbs of scratch NOAHZK_variable_width_sqr_dispatch_scratch needs; bounded the same way as NOAHZK_variable_width_mul_scratch_bound.
+// Karatsuba takes 3*(h+1) limbs, Toom-3 9*(k+1) & Toom-4 15*(k+1), plus 2*(k+1) for the interpolation.
+size_t NOAHZK_variable_width_sqr_dispatch_scratch_size(size_t width){
+    size_t width_scratch = 0;
+    while(width > NOAHZK_SQR_KARATSUBA_THRESHOLD){
+        const size_t h = width - width/2;
+        size_t width_tier = 3*(h + 1);
+        if(width > NOAHZK_SQR_TOOM3_THRESHOLD) width_tier = NOAHZK_MAX(width_tier, 11*((width + 2)/3 + 1));
+        if(width > NOAHZK_SQR_TOOM4_THRESHOLD) width_tier = NOAHZK_MAX(width_tier, 17*((width + 3)/4 + 1));
+        if(width > NOAHZK_MUL_NTT_THRESHOLD) width_tier = NOAHZK_MAX(width_tier, NOAHZK_variable_width_mul_ntt_scratch_size(width, width));
+
+        width_scratch += width_tier;
+        width = h + 1;
+    }
+    return width_scratch;
+}
+
+// same as above, with scratch from the default workspace
+void NOAHZK_variable_width_sqr_dispatch(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const src, const size_t width){
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_sqr_dispatch_scratch_size(width));
+    NOAHZK_variable_width_sqr_dispatch_scratch(dst, src, width, scratch);
+}
+
+size_t NOAHZK_variable_width_sqr_limb_scratch_size(const size_t width){
+    if(width == 0) return 0;
+    return 2*width + NOAHZK_variable_width_sqr_dispatch_scratch_size(width);
+}
+
+// dst = src^2 truncated (or zero-extended) to width_dst limbs; all widths in limbs.
+// dst may alias src. scratch has to be NOAHZK_variable_width_sqr_limb_scratch_size(width) limbs wide.
+// constant-time 
+void NOAHZK_variable_width_sqr_limb_scratch(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const size_t width, const size_t width_dst, NOAHZK_limb_t* const scratch){
+    if(width == 0){ memset(dst, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_dst)); return; }
+
+    const size_t width_product = 2*width;
+    NOAHZK_limb_t* const product = scratch;
+    NOAHZK_variable_width_sqr_dispatch_scratch(product, src, width, scratch + width_product);
+
+    const size_t width_copied = NOAHZK_MIN(width_dst, width_product);
+    memcpy(dst, product, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_copied));
+    memset(dst + width_copied, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_dst - width_copied));
+}
+
+void NOAHZK_variable_width_sqr_limb(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const size_t width, const size_t width_dst){
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_sqr_limb_scratch_size(width));
+    NOAHZK_variable_width_sqr_limb_scratch(dst, src, width, width_dst, scratch);
+}
+
+// dst = src^2 truncated or sign-extended to width_dst limbs, where src is a two's complement array whose sign is sign; squared in a single pass like above.
+// dst may alias src. scratch has to be NOAHZK_variable_width_sqr_limb_scratch_size(width) limbs wide. constant-time 
+void NOAHZK_variable_width_sqr_signed_limb_scratch(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const size_t width, const NOAHZK_limb_t sign, const size_t width_dst, NOAHZK_limb_t* const scratch){
+    if(width == 0){ memset(dst, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_dst)); return; }
+
+    const size_t width_product = 2*width;
+    NOAHZK_limb_t* const product = scratch;
+    NOAHZK_variable_width_sqr_dispatch_scratch(product, src, width, scratch + width_product);
+    NOAHZK_variable_width_mul_signed_fixup_primitive(product, src, src, width, width, sign, sign);
+    NOAHZK_variable_width_store_signed_primitive(dst, product, width_product, width_dst);
 }
 
 // variable-width mul primitives
 
-void NOAHZK_variable_width_mul_primitive(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1, const size_t new_dst_width){
-    NOAHZK_variable_width_t abs_rs0, abs_rs1;
-    NOAHZK_variable_width_copy_properties(&abs_rs0, rs0);
-    NOAHZK_variable_width_copy_properties(&abs_rs1, rs1);
-    NOAHZK_variable_width_abs(&abs_rs0, rs0);
-    NOAHZK_variable_width_abs(&abs_rs1, rs1);
-
-    NOAHZK_variable_width_mul_byte(dst->arr, abs_rs0.arr, abs_rs1.arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE(abs_rs0), NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE(abs_rs1), NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(new_dst_width));
-
-    NOAHZK_variable_width_destroy(&abs_rs0, NOAHZK_variable_width_keep_ptr);
-    NOAHZK_variable_width_destroy(&abs_rs1, NOAHZK_variable_width_keep_ptr);
-// updates width after multiplication so negate_conditionally operates over the correct area
-// done after because dst, rs0, rs1 may ALL alias
+// limbs of scratch the signed variable-width mul primitives need; the same as NOAHZK_variable_width_mul_limb_scratch_size, as the operands aren't copied
+size_t NOAHZK_variable_width_mul_primitive_scratch_size(const size_t width0, const size_t width1){
+    return NOAHZK_variable_width_mul_limb_scratch_size(width0, width1);
+}
+
+void NOAHZK_variable_width_mul_primitive_timed_scratch(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1, const size_t new_dst_width, const NOAHZK_variable_width_timing_t timing, NOAHZK_limb_t* const scratch){
+    NOAHZK_variable_width_mul_signed_limb_timed_scratch(dst->arr, rs0->arr, rs1->arr, rs0->width, rs1->width, rs0->sign, rs1->sign, new_dst_width, timing, scratch);
+// width updated after multiplication, as dst, rs0, rs1 may ALL alias
     dst->width = new_dst_width;
-    const NOAHZK_limb_t dst_sign = rs0->sign ^ rs1->sign;
-    NOAHZK_variable_width_negate_conditionally(dst, dst, dst_sign);
+    dst->sign = new_dst_width? NOAHZK_variable_width_get_sign(dst): 0;
+    NOAHZK_variable_width_drop_bitcnt(dst);
+}
+
+void NOAHZK_variable_width_mul_primitive_timed(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1, const size_t new_dst_width, const NOAHZK_variable_width_timing_t timing){
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_mul_primitive_scratch_size(rs0->width, rs1->width));
+    NOAHZK_variable_width_mul_primitive_timed_scratch(dst, rs0, rs1, new_dst_width, timing, scratch);
+}
+
+void NOAHZK_variable_width_mul_primitive(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1, const size_t new_dst_width){
+    NOAHZK_variable_width_mul_primitive_timed(dst, rs0, rs1, new_dst_width, NOAHZK_variable_width_constant_time);
 }
 
 // faster than signed counterpart; assumes both rs0 and rs1 have sign == 0. do not use if this cannot be guaranteed.
-void NOAHZK_variable_width_mul_unsigned_primitive(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1, const size_t new_dst_width){
-    NOAHZK_variable_width_mul_byte(dst->arr, rs0->arr, rs1->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(rs0), NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(rs1), NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(new_dst_width));
+// scratch has to be NOAHZK_variable_width_mul_limb_scratch_size(rs0->width, rs1->width) limbs wide.
+void NOAHZK_variable_width_mul_unsigned_primitive_timed_scratch(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1, const size_t new_dst_width, const NOAHZK_variable_width_timing_t timing, NOAHZK_limb_t* const scratch){
+    NOAHZK_variable_width_mul_limb_timed_scratch(dst->arr, rs0->arr, rs1->arr, rs0->width, rs1->width, new_dst_width, timing, scratch);
     dst->width = new_dst_width;
     dst->sign = 0;
+    NOAHZK_variable_width_drop_bitcnt(dst);
 }
 
-void NOAHZK_variable_width_mul_constant_primitive(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const uint64_t k, const size_t width_k, const size_t new_dst_width){
-    NOAHZK_variable_width_t abs_rs0;
-    NOAHZK_variable_width_copy_properties(&abs_rs0, rs0);
-    NOAHZK_variable_width_abs(&abs_rs0, rs0);
+void NOAHZK_variable_width_mul_unsigned_primitive_timed(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1, const size_t new_dst_width, const NOAHZK_variable_width_timing_t timing){
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_mul_limb_scratch_size(rs0->width, rs1->width));
+    NOAHZK_variable_width_mul_unsigned_primitive_timed_scratch(dst, rs0, rs1, new_dst_width, timing, scratch);
+}
+
+void NOAHZK_variable_width_mul_unsigned_primitive(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1, const size_t new_dst_width){
+    NOAHZK_variable_width_mul_unsigned_primitive_timed(dst, rs0, rs1, new_dst_width, NOAHZK_variable_width_constant_time);
+}
+
+// limbs of scratch NOAHZK_variable_width_mul_constant_primitive_scratch needs; k is at most 64 bits wide
+size_t NOAHZK_variable_width_mul_constant_primitive_scratch_size(const size_t width0){
+    return NOAHZK_variable_width_mul_limb_scratch_size(width0, NOAHZK_SIZE_AS_ARR_OF_TYPE(sizeof(uint64_t), sizeof(NOAHZK_limb_t)));
+}
+
+void NOAHZK_variable_width_mul_constant_primitive_scratch(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const uint64_t k, const size_t width_k, const size_t new_dst_width, NOAHZK_limb_t* const scratch){
+// k is split into limbs by value rather than by memcpy, so it doesn't depend on the endianness of the machine
+    NOAHZK_limb_t k_arr[NOAHZK_SIZE_AS_ARR_OF_TYPE(sizeof(k), sizeof(NOAHZK_limb_t))];
+    for(size_t i = 0; i < sizeof(k_arr)/sizeof(NOAHZK_limb_t); i++) k_arr[i] = NOAHZK_get_section_from_var(k, NOAHZK_LIMB_MAX, i, NOAHZK_limb_t);
 
-    NOAHZK_variable_width_mul_byte(dst->arr, abs_rs0.arr, &k, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE(abs_rs0), width_k, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(new_dst_width));
+    NOAHZK_variable_width_mul_signed_limb_scratch(dst->arr, rs0->arr, k_arr, rs0->width, NOAHZK_MIN(NOAHZK_GET_LIMB_WIDTH_FROM_INT(width_k), sizeof(k_arr)/sizeof(NOAHZK_limb_t)), rs0->sign, 0, new_dst_width, scratch);
 
-    NOAHZK_variable_width_destroy(&abs_rs0, NOAHZK_variable_width_keep_ptr);
     dst->width = new_dst_width;
-    const NOAHZK_limb_t dst_sign = rs0->sign;
-    NOAHZK_variable_width_negate_conditionally(dst, dst, dst_sign);
+    dst->sign = new_dst_width? NOAHZK_variable_width_get_sign(dst): 0;
+    NOAHZK_variable_width_drop_bitcnt(dst);
+}
+
+void NOAHZK_variable_width_mul_constant_primitive(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const uint64_t k, const size_t width_k, const size_t new_dst_width){
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_mul_constant_primitive_scratch_size(rs0->width));
+    NOAHZK_variable_width_mul_constant_primitive_scratch(dst, rs0, k, width_k, new_dst_width, scratch);
 }
 
 // functions that use said primitives
@@ -144,12 +783,39 @@ void NOAHZK_variable_width_mul_constant(NOAHZK_variable_width_t* const dst, cons
 void NOAHZK_variable_width_mul_and_resize(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1){
     const size_t new_width = NOAHZK_variable_width_resize_to_sum(dst, rs0->width, rs1->width);
     NOAHZK_variable_width_mul_primitive(dst, rs0, rs1, new_width);
+    NOAHZK_variable_width_auto_trim(dst);
 }
 
 // multiplies two variable width variables together, returns the result in dst
 void NOAHZK_variable_width_mul_and_resize_unsigned(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1){
     const size_t new_width = NOAHZK_variable_width_resize_to_sum(dst, rs0->width, rs1->width);
     NOAHZK_variable_width_mul_unsigned_primitive(dst, rs0, rs1, new_width);
+    NOAHZK_variable_width_auto_trim(dst);
+}
+
+// not constant-time; for public operands only. dst = rs0*rs1 truncated or sign-extended to dst's width, multiplying only the limbs the operands' values need.
+void NOAHZK_variable_width_mul_vartime(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1){
+    NOAHZK_variable_width_mul_primitive_timed(dst, rs0, rs1, dst->width, NOAHZK_variable_width_variable_time);
+}
+
+// not constant-time; for public operands only. picks the multiplication algorithm (& NTT size) by the operands' values rather than their widths,
+// & dst is sized by them too: it ends up as wide as the product needs (at least one limb).
+void NOAHZK_variable_width_mul_and_resize_vartime(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1){
+    size_t width0, width1;
+    NOAHZK_variable_width_mul_widths_vartime(&width0, &width1, rs0->arr, rs1->arr, rs0->width, rs1->width, rs0->sign, rs1->sign);
+    const size_t new_width = NOAHZK_MAX(width0 + width1, 1);
+    NOAHZK_variable_width_grow(dst, new_width);
+    NOAHZK_variable_width_mul_primitive_timed(dst, rs0, rs1, new_width, NOAHZK_variable_width_variable_time);
+    NOAHZK_variable_width_normalize_vartime(dst);
+}
+
+// not constant-time; for public operands only. assumes both rs0 and rs1 have sign == 0, like NOAHZK_variable_width_mul_and_resize_unsigned.
+void NOAHZK_variable_width_mul_and_resize_unsigned_vartime(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1){
+    const size_t width0 = NOAHZK_variable_width_significant_width_vartime(rs0->arr, rs0->width, 0), width1 = NOAHZK_variable_width_significant_width_vartime(rs1->arr, rs1->width, 0);
+    const size_t new_width = NOAHZK_MAX(width0 + width1, 1);
+    NOAHZK_variable_width_grow(dst, new_width);
+    NOAHZK_variable_width_mul_unsigned_primitive_timed(dst, rs0, rs1, new_width, NOAHZK_variable_width_variable_time);
+    NOAHZK_variable_width_normalize_vartime(dst);
 }
 
 void NOAHZK_variable_width_mul_and_resize_constant(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_limb_t k){
@@ -157,29 +823,44 @@ void NOAHZK_variable_width_mul_and_resize_constant(NOAHZK_variable_width_t* cons
     const size_t new_width = NOAHZK_variable_width_resize_to_sum(dst, rs0->width, limbs_k);
 
     NOAHZK_variable_width_mul_constant_primitive(dst, rs0, k, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(limbs_k), new_width);
+    NOAHZK_variable_width_auto_trim(dst);
 }
 
+// dst = src**2; assumes src has sign == 0.
 void NOAHZK_variable_width_square_and_resize_unsigned(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src){
-    NOAHZK_variable_width_mul_and_resize_unsigned(dst, src, src);
+    const size_t new_width = NOAHZK_variable_width_resize_to_sum(dst, src->width, src->width);
+    NOAHZK_variable_width_sqr_limb(dst->arr, src->arr, src->width, new_width);
+    dst->width = new_width;
+    dst->sign = 0;
+    NOAHZK_variable_width_drop_bitcnt(dst);
+    NOAHZK_variable_width_auto_trim(dst);
 }
 
-// dst = rs0 * rs1**power, where power is an unsigned 64-bit integer
-void NOAHZK_variable_width_mul_to_power_and_resize_constant(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1, const uint64_t power){
-    NOAHZK_variable_width_t product; 
-    NOAHZK_variable_width_init_and_resize_unsigned_constant(&product, 1);
-    for(uint64_t i = 0; i < power; i++) NOAHZK_variable_width_mul_and_resize(&product, &product, rs1);
+// dst = src**2, for signed src, truncated or sign-extended to new_dst_width limbs; dst has to be able to hold that many. dst may alias src.
+void NOAHZK_variable_width_square_primitive(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const size_t new_dst_width){
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_sqr_limb_scratch_size(src->width));
+    NOAHZK_variable_width_sqr_signed_limb_scratch(dst->arr, src->arr, src->width, src->sign, new_dst_width, scratch);
+
+    dst->width = new_dst_width;
+    dst->sign = new_dst_width? NOAHZK_variable_width_get_sign(dst): 0;
+    NOAHZK_variable_width_drop_bitcnt(dst);
+}
 
-    NOAHZK_variable_width_mul_and_resize(dst, rs0, &product);
-    NOAHZK_variable_width_destroy(&product, NOAHZK_variable_width_keep_ptr);
+// dst = src**2, for signed src
+void NOAHZK_variable_width_square_and_resize(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src){
+    const size_t new_width = NOAHZK_variable_width_resize_to_sum(dst, src->width, src->width);
+    NOAHZK_variable_width_square_primitive(dst, src, new_width);
+    NOAHZK_variable_width_auto_trim(dst);
 }
 
 // dst += rs0*rs1
 void NOAHZK_variable_width_madd_and_resize(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1){
-    NOAHZK_variable_width_t product = NOAHZK_variable_width_INITIALISER;
-    NOAHZK_variable_width_mul_and_resize(&product, rs0, rs1);
+    NOAHZK_variable_width_t product;
+    NOAHZK_variable_width_init_temporary(&product, rs0->width + rs1->width);
+    NOAHZK_variable_width_mul_primitive(&product, rs0, rs1, product.width);
 
     NOAHZK_variable_width_add_and_resize(dst, dst, &product);
-    NOAHZK_variable_width_destroy(&product, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy_temporary(&product);
 }
 
 // dst = (dst + rs1)*rs2, where all are variable-width vars.
@@ -199,12 +880,14 @@ void NOAHZK_variable_width_add_and_mul_and_resize(NOAHZK_variable_width_t* const
 void* NOAHZK_variable_width_n_minus_2_triangle_number(NOAHZK_variable_width_t* dst, const NOAHZK_variable_width_t* const restrict n){
     if(!dst) dst = NOAHZK_variable_width_init(NULL, 0);
 
-    NOAHZK_variable_width_t n2 = NOAHZK_variable_width_INITIALISER;
-    NOAHZK_variable_width_sub_and_resize_constant(&n2, n, 2);                   // n2 = n-2
+// n2 is a limb wider than n & 2, so n-2 can't overflow it
+    NOAHZK_variable_width_t n2;
+    NOAHZK_variable_width_init_temporary(&n2, NOAHZK_MAX(n->width, NOAHZK_SIZE_AS_ARR_OF_TYPE(sizeof(uint64_t), sizeof(NOAHZK_limb_t))) + 1);
+    NOAHZK_variable_width_sub_constant(&n2, n, 2);                              // n2 = n-2
     NOAHZK_variable_width_square_and_resize_unsigned(dst, &n2);                 // dst = n2**2
     NOAHZK_variable_width_add_and_resize(dst, dst, &n2);                        // dst = n2**2 + n2
-    NOAHZK_variable_width_destroy(&n2, NOAHZK_variable_width_keep_ptr);         // // no longer needed
-    NOAHZK_variable_width_shift_right_constant(dst, dst, 1);                    // dst = (n2**2 + n2)/2
+    NOAHZK_variable_width_destroy_temporary(&n2);                               // // no longer needed
+    NOAHZK_variable_width_shift_right(dst, dst, 1);                             // dst = (n2**2 + n2)/2
 
     return dst;
 }
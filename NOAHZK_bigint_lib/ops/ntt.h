@@ -0,0 +1,236 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+#ifndef NOAHZK_bigint_ntt_included
+#define NOAHZK_bigint_ntt_included
+
+#include "definitions.h"    // NOAHZK variable-width type
+#include "stdint.h"         // integer types
+#include "alloc.h"          // NOAHZK_temporary_malloc
+#include "string.h"         // memset
+
+// three-prime NTT multiplication: operands are cut into 16-bit coefficients, convolved modulo three ~30-bit primes
+// and the exact coefficients are recovered with the CRT (Garner's algorithm), then carried back into limbs.
+// a coefficient of the convolution is at most 2^NOAHZK_NTT_LOG2_MAX_SIZE * (2^16 - 1)^2 < 2^55, way below the product of the primes (~2^85).
+// all prime arithmetic is plain C99 on uint64_t, in Montgomery form with R = 2^32.
+// the transforms don't depend on the values being multiplied, only on their widths, & the CRT reduces with the same branch-free
+// Montgomery multiplications rather than %, so the whole thing is constant-time. % is only used on the primes & the sizes, which are public.
+
+#define NOAHZK_NTT_PRIMES               3
+#define NOAHZK_NTT_COEFFICIENT_BITS     16
+#define NOAHZK_NTT_COEFFICIENT_MASK     UINT16_MAX
+#define NOAHZK_NTT_COEFFICIENTS_PER_LIMB (BITS_IN_NOAHZK_LIMB/NOAHZK_NTT_COEFFICIENT_BITS)
+#define NOAHZK_NTT_LOG2_MAX_SIZE        23      // 998244353 - 1 == 119 * 2^23 is the smallest power of two among the three primes
+
+typedef struct{
+    uint32_t p;             // prime
+    uint32_t p_inv_neg;     // -p^-1 mod 2^32
+    uint32_t r2;            // 2^64 mod p
+    uint32_t generator;     // primitive root mod p
+} NOAHZK_ntt_prime_t;
+
+static const NOAHZK_ntt_prime_t NOAHZK_ntt_primes[NOAHZK_NTT_PRIMES] = {
+    {998244353, 0, 0, 3},
+    {167772161, 0, 0, 3},
+    {469762049, 0, 0, 3},
+};
+
+// a*b*2^-32 mod p, for a*b < p*2^32; branch-free.
+uint32_t NOAHZK_ntt_mont_mul(const uint32_t a, const uint32_t b, const NOAHZK_ntt_prime_t* const prime){
+    const uint64_t t = (uint64_t)a * b;
+    const uint32_t m = (uint32_t)t * prime->p_inv_neg;
+    const uint32_t u = (t + (uint64_t)m * prime->p) >> BITS_IN_UINT32_T;
+    const uint32_t mask = -(uint32_t)(u >= prime->p);
+    return u - (prime->p & mask);
+}
+
+uint32_t NOAHZK_ntt_add(const uint32_t a, const uint32_t b, const uint32_t p){
+    const uint32_t z = a + b;
+    return z - (p & -(uint32_t)(z >= p));
+}
+
+uint32_t NOAHZK_ntt_sub(const uint32_t a, const uint32_t b, const uint32_t p){
+    const uint32_t z = a - b;
+    return z + (p & -(uint32_t)(a < b));
+}
+
+// only used for setup & CRT constants; not on secret data.
+uint64_t NOAHZK_ntt_pow(uint64_t base, uint64_t exponent, const uint64_t p){
+    uint64_t result = 1;
+    base %= p;
+    for(; exponent; exponent >>= 1){
+        if(exponent & 1) result = result * base % p;
+        base = base * base % p;
+    }
+    return result;
+}
+
+// fills in the derived constants of prime
+NOAHZK_ntt_prime_t NOAHZK_ntt_prime_setup(const NOAHZK_ntt_prime_t* const src){
+    NOAHZK_ntt_prime_t prime = *src;
+    uint32_t inv = prime.p;
+    for(size_t correct_bits = 3; correct_bits < BITS_IN_UINT32_T; correct_bits *= 2) inv *= 2 - prime.p*inv;
+    prime.p_inv_neg = -inv;
+    const uint64_t r = ((uint64_t)1 << BITS_IN_UINT32_T) % prime.p;
+    prime.r2 = r * r % prime.p;
+    return prime;
+}
+
+// roots[j] = w^j in Montgomery form for j < size/2, where w is a primitive size-th root of unity (or its inverse)
+void NOAHZK_ntt_roots(uint32_t* const roots, const size_t size, const NOAHZK_ntt_prime_t* const prime, const int inverse){
+    uint64_t w = NOAHZK_ntt_pow(prime->generator, (prime->p - 1)/size, prime->p);
+    if(inverse) w = NOAHZK_ntt_pow(w, prime->p - 2, prime->p);
+
+    const uint32_t w_mont = NOAHZK_ntt_mont_mul(w, prime->r2, prime);
+    uint32_t x = NOAHZK_ntt_mont_mul(1, prime->r2, prime);
+    for(size_t j = 0; j < size/2; j++){
+        roots[j] = x;
+        x = NOAHZK_ntt_mont_mul(x, w_mont, prime);
+    }
+}
+
+// decimation in frequency; natural order in, bit-reversed order out
+void NOAHZK_ntt_forward(uint32_t* const a, const size_t size, const uint32_t* const roots, const NOAHZK_ntt_prime_t* const prime){
+    for(size_t len = size; len >= 2; len >>= 1){
+        const size_t half = len/2, step = size/len;
+        for(size_t i = 0; i < size; i += len)
+            for(size_t j = 0; j < half; j++){
+                const uint32_t u = a[i+j], v = a[i+j+half];
+                a[i+j] = NOAHZK_ntt_add(u, v, prime->p);
+                a[i+j+half] = NOAHZK_ntt_mont_mul(NOAHZK_ntt_sub(u, v, prime->p), roots[j*step], prime);
+            }
+    }
+}
+
+// decimation in time; bit-reversed order in, natural order out, unscaled
+void NOAHZK_ntt_inverse(uint32_t* const a, const size_t size, const uint32_t* const roots, const NOAHZK_ntt_prime_t* const prime){
+    for(size_t len = 2; len <= size; len <<= 1){
+        const size_t half = len/2, step = size/len;
+        for(size_t i = 0; i < size; i += len)
+            for(size_t j = 0; j < half; j++){
+                const uint32_t u = a[i+j], v = NOAHZK_ntt_mont_mul(a[i+j+half], roots[j*step], prime);
+                a[i+j] = NOAHZK_ntt_add(u, v, prime->p);
+                a[i+j+half] = NOAHZK_ntt_sub(u, v, prime->p);
+            }
+    }
+}
+
+// cuts width limbs of src into 16-bit coefficients, zero-padding them up to size
+void NOAHZK_ntt_load(uint32_t* const dst, const NOAHZK_limb_t* const src, const size_t width, const size_t size){
+    const size_t coefficients = width*NOAHZK_NTT_COEFFICIENTS_PER_LIMB;
+    for(size_t i = 0; i < coefficients; i++)
+        dst[i] = src[i/NOAHZK_NTT_COEFFICIENTS_PER_LIMB] >> (i%NOAHZK_NTT_COEFFICIENTS_PER_LIMB)*NOAHZK_NTT_COEFFICIENT_BITS & NOAHZK_NTT_COEFFICIENT_MASK;
+    memset(dst + coefficients, 0, (size - coefficients)*sizeof(uint32_t));
+}
+
+// number of points the transform needs for a width0 x width1 limb product; a power of two.
+size_t NOAHZK_ntt_size(const size_t width0, const size_t width1){
+    const size_t coefficients = (width0 + width1)*NOAHZK_NTT_COEFFICIENTS_PER_LIMB - 1;
+    size_t size = 1;
+    while(size < coefficients) size <<= 1;
+    return size;
+}
+
+// whether a width0 x width1 limb product is within reach of the three primes' roots of unity
+int NOAHZK_variable_width_mul_ntt_fits(const size_t width0, const size_t width1){
+    return (width0 + width1)*NOAHZK_NTT_COEFFICIENTS_PER_LIMB - 1 <= (size_t)1 << NOAHZK_NTT_LOG2_MAX_SIZE;
+}
+
+// limbs of scratch NOAHZK_variable_width_mul_ntt_scratch needs: 4 words per point of the transform & the roots
+size_t NOAHZK_variable_width_mul_ntt_scratch_size(const size_t width0, const size_t width1){
+    return NOAHZK_SIZE_AS_ARR_OF_TYPE((NOAHZK_NTT_PRIMES + 2)*NOAHZK_ntt_size(width0, width1)*sizeof(uint32_t), sizeof(NOAHZK_limb_t));
+}
+
+// dst = rs0*rs1, writing all width0 + width1 limbs of dst. both widths have to be nonzero & NOAHZK_variable_width_mul_ntt_fits(width0, width1).
+// dst may alias either source; when rs0 == rs1 it squares. scratch has to be NOAHZK_variable_width_mul_ntt_scratch_size(width0, width1) limbs wide.
+void NOAHZK_variable_width_mul_ntt_scratch(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1, NOAHZK_limb_t* const scratch){
+    const size_t size = NOAHZK_ntt_size(width0, width1);
+    uint32_t* const residues = (uint32_t*)scratch;
+    uint32_t* const other = residues + NOAHZK_NTT_PRIMES*size;
+    uint32_t* const roots = other + size;
+// squares only need one forward transform per prime
+    const int square = rs0 == rs1 && width0 == width1;
+
+    for(size_t k = 0; k < NOAHZK_NTT_PRIMES; k++){
+        const NOAHZK_ntt_prime_t prime = NOAHZK_ntt_prime_setup(&NOAHZK_ntt_primes[k]);
+        uint32_t* const a = residues + k*size;
+
+        NOAHZK_ntt_roots(roots, size, &prime, 0);
+        NOAHZK_ntt_load(a, rs0, width0, size);
+        NOAHZK_ntt_forward(a, size, roots, &prime);
+        if(!square){
+            NOAHZK_ntt_load(other, rs1, width1, size);
+            NOAHZK_ntt_forward(other, size, roots, &prime);
+        }
+// the pointwise product comes out times 2^-32, which gets folded into the final scaling by size^-1 * 2^64
+        for(size_t i = 0; i < size; i++) a[i] = NOAHZK_ntt_mont_mul(a[i], square? a[i]: other[i], &prime);
+
+        NOAHZK_ntt_roots(roots, size, &prime, 1);
+        NOAHZK_ntt_inverse(a, size, roots, &prime);
+        const uint32_t scale = NOAHZK_ntt_mont_mul(NOAHZK_ntt_mont_mul(NOAHZK_ntt_pow(size, prime.p - 2, prime.p), prime.r2, &prime), prime.r2, &prime);
+        for(size_t i = 0; i < size; i++) a[i] = NOAHZK_ntt_mont_mul(a[i], scale, &prime);
+    }
+
+// Garner: x = x0 + x1*p0 + x2*p0*p1, with x0 < p0, x1 < p1, x2 < p2.
+// the residues come from the operands, so they're reduced with Montgomery multiplications instead of %, which may take longer on some values:
+// mont_mul(x, r2) takes any x < 2^30 to x*2^32 mod p, & a Montgomery product with a constant in normal form takes that back out again.
+    const NOAHZK_ntt_prime_t prime1 = NOAHZK_ntt_prime_setup(&NOAHZK_ntt_primes[1]), prime2 = NOAHZK_ntt_prime_setup(&NOAHZK_ntt_primes[2]);
+    const uint64_t p0 = NOAHZK_ntt_primes[0].p, p1 = prime1.p, p2 = prime2.p;
+    const uint32_t p0_inv_mod_p1 = NOAHZK_ntt_pow(p0, p1 - 2, p1);
+    const uint32_t p0_inv_mod_p2 = NOAHZK_ntt_pow(p0, p2 - 2, p2), p1_inv_mod_p2 = NOAHZK_ntt_pow(p1, p2 - 2, p2);
+    const uint64_t p0p1 = p0*p1;
+
+// carry is a 128-bit value split into two uint64_t
+    uint64_t carry_lo = 0, carry_hi = 0;
+    const size_t coefficients = (width0 + width1)*NOAHZK_NTT_COEFFICIENTS_PER_LIMB;
+    NOAHZK_limb_t limb = 0;
+
+    for(size_t i = 0; i < coefficients; i++){
+        if(i < size){
+            const uint32_t x0 = residues[i];
+            const uint32_t x0_1 = NOAHZK_ntt_mont_mul(x0, prime1.r2, &prime1), x0_2 = NOAHZK_ntt_mont_mul(x0, prime2.r2, &prime2);
+            const uint64_t x1 = NOAHZK_ntt_mont_mul(NOAHZK_ntt_sub(NOAHZK_ntt_mont_mul(residues[size + i], prime1.r2, &prime1), x0_1, p1), p0_inv_mod_p1, &prime1);
+            const uint32_t y2 = NOAHZK_ntt_mont_mul(NOAHZK_ntt_sub(NOAHZK_ntt_mont_mul(residues[2*size + i], prime2.r2, &prime2), x0_2, p2), p0_inv_mod_p2, &prime2);
+            const uint64_t x2 = NOAHZK_ntt_mont_mul(NOAHZK_ntt_sub(NOAHZK_ntt_mont_mul(y2, prime2.r2, &prime2), NOAHZK_ntt_mont_mul(x1, prime2.r2, &prime2), p2), p1_inv_mod_p2, &prime2);
+
+            const uint64_t low = x0 + x1*p0;                                                    // < 2^60
+            const uint64_t x2_lo = x2*(p0p1 & UINT32_MAX), x2_hi = x2*(p0p1 >> BITS_IN_UINT32_T);  // both < 2^62
+            uint64_t sum = carry_lo + low;
+            carry_hi += sum < low;
+            carry_lo = sum + x2_lo;
+            carry_hi += carry_lo < sum;
+            sum = carry_lo + (x2_hi << BITS_IN_UINT32_T);
+            carry_hi += (sum < carry_lo) + (x2_hi >> BITS_IN_UINT32_T);
+            carry_lo = sum;
+        }
+
+        limb |= (NOAHZK_limb_t)(carry_lo & NOAHZK_NTT_COEFFICIENT_MASK) << (i%NOAHZK_NTT_COEFFICIENTS_PER_LIMB)*NOAHZK_NTT_COEFFICIENT_BITS;
+        carry_lo = carry_lo >> NOAHZK_NTT_COEFFICIENT_BITS | carry_hi << (BITS_IN_UINT64_T - NOAHZK_NTT_COEFFICIENT_BITS);
+        carry_hi >>= NOAHZK_NTT_COEFFICIENT_BITS;
+
+        if(i%NOAHZK_NTT_COEFFICIENTS_PER_LIMB == NOAHZK_NTT_COEFFICIENTS_PER_LIMB - 1){
+            dst[i/NOAHZK_NTT_COEFFICIENTS_PER_LIMB] = limb;
+            limb = 0;
+        }
+    }
+
+}
+
+// same as above, but takes its scratch from the temporary allocator; returns 0 if that fails, 1 otherwise.
+int NOAHZK_variable_width_mul_ntt(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width0, const size_t width1){
+    const size_t width_scratch = NOAHZK_variable_width_mul_ntt_scratch_size(width0, width1);
+    NOAHZK_limb_t* const scratch = NOAHZK_temporary_malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+    if(!scratch) return 0;
+
+    NOAHZK_variable_width_mul_ntt_scratch(dst, rs0, rs1, width0, width1, scratch);
+
+    NOAHZK_temporary_free(scratch, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+    return 1;
+}
+
+#endif
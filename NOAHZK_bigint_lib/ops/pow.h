@@ -0,0 +1,344 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+#ifndef NOAHZK_bigint_pow_included
+#define NOAHZK_bigint_pow_included
+
+#include "definitions.h"    // NOAHZK variable-width type
+#include "logarithms.h"     // NOAHZK_variable_width_bitcnt_vartime_primitive
+#include "alloc.h"          // NOAHZK_temporary_malloc
+#include "type.h"           // NOAHZK_variable_width_init_temporary
+#include "logic.h"          // NOAHZK_variable_width_swap_conditionally_primitive
+#include "mul.h"            // limb multiplication & squaring
+#include "montgomery.h"     // Montgomery form, for the modular forms
+#include "stdint.h"         // integer types
+#include "string.h"         // memset, memcpy
+
+// exponentiation by square-and-multiply, with the exponent a variable-width var, always read as unsigned.
+// secret exponents get a fixed window (or the Montgomery ladder): the same squarings & multiplications for every exponent of a given width,
+// with the table entry picked by reading the whole table. public exponents get a sliding window over odd powers, which skips runs of zero bits.
+// the modular forms work in Montgomery form, for bases < N; the plain forms either truncate to dst's width or grow dst to the whole result.
+// every temporary comes from the temporary allocator.
+
+// bits of exponent per multiplication in the constant-time forms; the table has 2^NOAHZK_POW_WINDOW entries
+#ifndef NOAHZK_POW_WINDOW
+#define NOAHZK_POW_WINDOW 4
+#endif
+
+// longest window in the vartime forms; the table has 2^(NOAHZK_POW_SLIDING_WINDOW - 1) odd powers
+#ifndef NOAHZK_POW_SLIDING_WINDOW
+#define NOAHZK_POW_SLIDING_WINDOW 5
+#endif
+
+// the width_window bits of src (width limbs wide) starting at bit, read as unsigned; bits past src are 0.
+// width_window has to be less than BITS_IN_NOAHZK_LIMB. only depends on the position being public; constant-time
+NOAHZK_limb_t NOAHZK_variable_width_get_bits_primitive(const NOAHZK_limb_t* const src, const size_t width, const size_t bit, const size_t width_window){
+    const size_t index = bit/BITS_IN_NOAHZK_LIMB, shamt = bit%BITS_IN_NOAHZK_LIMB;
+    NOAHZK_expanded_limb_t window = index < width? src[index]: 0;
+    if(index + 1 < width) window |= (NOAHZK_expanded_limb_t)src[index + 1] << BITS_IN_NOAHZK_LIMB;
+    return (window >> shamt) & (((NOAHZK_limb_t)1 << width_window) - 1);
+}
+
+// dst = entry index of table, which holds count entries of width limbs one after another.
+// every entry is read & masked, so the memory accesses don't depend on index. constant-time
+void NOAHZK_variable_width_select_from_table_primitive(NOAHZK_limb_t* const restrict dst, const NOAHZK_limb_t* const restrict table, const size_t count, const size_t width, const size_t index){
+    memset(dst, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    for(size_t j = 0; j < count; j++){
+// x | -x has its top bit set unless x == 0, without comparing
+        const size_t x = j ^ index;
+        const NOAHZK_limb_t mask = -(NOAHZK_limb_t)(((x | -x) >> (sizeof(size_t)*BITS_IN_UINT8_T - 1)) ^ 1);
+        for(size_t i = 0; i < width; i++) dst[i] |= table[j*width + i] & mask;
+    }
+}
+
+// modular forms
+// dst has to be at least ctx->width limbs wide, as with the rest of the Montgomery ops; base < N.
+
+// dst = src*R^-1 mod N, where src is ctx->width limbs wide; scratch is 2*ctx->width limbs wide.
+void NOAHZK_variable_width_pow_mod_finish(NOAHZK_variable_width_t* const dst, const NOAHZK_limb_t* const src, const NOAHZK_montgomery_ctx_t* const ctx, NOAHZK_limb_t* const scratch){
+    memcpy(scratch, src, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(ctx->width));
+    memset(scratch + ctx->width, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(ctx->width));
+    NOAHZK_variable_width_mont_redc_primitive(dst->arr, scratch, ctx->modulus.arr, ctx->n0_inv_neg, ctx->width);
+    NOAHZK_variable_width_mont_finish(dst, ctx);
+}
+
+// dst = base^exponent mod N. fixed-window: every NOAHZK_POW_WINDOW bits of exponent cost as many squarings & one multiplication,
+// so time & memory accesses only depend on exponent->width, never on its value; for secret exponents.
+// dst may alias base or exponent.
+void NOAHZK_variable_width_pow_mod(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const base, const NOAHZK_variable_width_t* const exponent, const NOAHZK_montgomery_ctx_t* const ctx){
+    const size_t width = ctx->width, count = (size_t)1 << NOAHZK_POW_WINDOW;
+    const size_t width_scratch = (count + 3)*width;
+    NOAHZK_limb_t* const table = NOAHZK_temporary_malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+    NOAHZK_limb_t* const acc = table + count*width, *const entry = acc + width;      // entry is 2*width limbs wide, for pow_mod_finish
+
+// table[i] = base^i in Montgomery form
+    memcpy(table, ctx->r.arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    NOAHZK_variable_width_mont_mul_primitive(table + width, NOAHZK_variable_width_mont_operand(entry, base, ctx), ctx->r2.arr, ctx->modulus.arr, ctx->n0_inv_neg, width);
+    for(size_t i = 2; i < count; i++) NOAHZK_variable_width_mont_mul_primitive(table + i*width, table + (i - 1)*width, table + width, ctx->modulus.arr, ctx->n0_inv_neg, width);
+
+    memcpy(acc, table, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    const size_t windows = NOAHZK_SIZE_AS_ARR_OF_TYPE(exponent->width*BITS_IN_NOAHZK_LIMB, NOAHZK_POW_WINDOW);
+    for(size_t i = windows; i-- > 0;){
+        for(size_t j = 0; j < NOAHZK_POW_WINDOW; j++) NOAHZK_variable_width_mont_sqr_primitive(acc, acc, ctx->modulus.arr, ctx->n0_inv_neg, width);
+        NOAHZK_variable_width_select_from_table_primitive(entry, table, count, width, NOAHZK_variable_width_get_bits_primitive(exponent->arr, exponent->width, i*NOAHZK_POW_WINDOW, NOAHZK_POW_WINDOW));
+        NOAHZK_variable_width_mont_mul_primitive(acc, acc, entry, ctx->modulus.arr, ctx->n0_inv_neg, width);
+    }
+
+    NOAHZK_variable_width_pow_mod_finish(dst, acc, ctx, entry);
+    NOAHZK_temporary_free(table, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+}
+
+// same as above, with the Montgomery ladder: a multiplication & a squaring per bit of exponent, on two values swapped in constant time.
+// slower than the fixed window, but it needs no table. dst may alias base or exponent.
+void NOAHZK_variable_width_pow_mod_ladder(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const base, const NOAHZK_variable_width_t* const exponent, const NOAHZK_montgomery_ctx_t* const ctx){
+    const size_t width = ctx->width;
+    const size_t width_scratch = 4*width;
+    NOAHZK_limb_t* const r0 = NOAHZK_temporary_malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+    NOAHZK_limb_t* const r1 = r0 + width, *const t = r1 + width;
+
+// r1 = r0*base all along
+    memcpy(r0, ctx->r.arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    NOAHZK_variable_width_mont_mul_primitive(r1, NOAHZK_variable_width_mont_operand(t, base, ctx), ctx->r2.arr, ctx->modulus.arr, ctx->n0_inv_neg, width);
+
+    for(size_t i = exponent->width*BITS_IN_NOAHZK_LIMB; i-- > 0;){
+        const NOAHZK_limb_t bit = NOAHZK_variable_width_get_bits_primitive(exponent->arr, exponent->width, i, 1);
+        NOAHZK_variable_width_swap_conditionally_primitive(r0, r1, width, bit);
+        NOAHZK_variable_width_mont_mul_primitive(r1, r0, r1, ctx->modulus.arr, ctx->n0_inv_neg, width);
+        NOAHZK_variable_width_mont_sqr_primitive(r0, r0, ctx->modulus.arr, ctx->n0_inv_neg, width);
+        NOAHZK_variable_width_swap_conditionally_primitive(r0, r1, width, bit);
+    }
+
+    NOAHZK_variable_width_pow_mod_finish(dst, r0, ctx, t);
+    NOAHZK_temporary_free(r0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+}
+
+// not constant-time
+// number of significant bits in src (width limbs wide), read as unsigned
+size_t NOAHZK_variable_width_pow_bitcnt_vartime(const NOAHZK_limb_t* const src, const size_t width){
+    return NOAHZK_variable_width_bitcnt_vartime_primitive(src, width);
+}
+
+// not constant-time; for public exponents only.
+// dst = base^exponent mod N. sliding-window: zero bits cost a squaring each, & every window of up to NOAHZK_POW_SLIDING_WINDOW bits
+// that starts & ends with a 1 one multiplication by an odd power of base, so it does fewer multiplications with half the table.
+// dst may alias base or exponent.
+void NOAHZK_variable_width_pow_mod_vartime(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const base, const NOAHZK_variable_width_t* const exponent, const NOAHZK_montgomery_ctx_t* const ctx){
+    const size_t width = ctx->width, count = (size_t)1 << (NOAHZK_POW_SLIDING_WINDOW - 1);
+    const size_t width_scratch = (count + 3)*width;
+    NOAHZK_limb_t* const table = NOAHZK_temporary_malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+    NOAHZK_limb_t* const acc = table + count*width, *const t = acc + width;
+
+// table[i] = base^(2i + 1) in Montgomery form; t holds base^2 meanwhile
+    NOAHZK_variable_width_mont_mul_primitive(table, NOAHZK_variable_width_mont_operand(t, base, ctx), ctx->r2.arr, ctx->modulus.arr, ctx->n0_inv_neg, width);
+    NOAHZK_variable_width_mont_sqr_primitive(t, table, ctx->modulus.arr, ctx->n0_inv_neg, width);
+    for(size_t i = 1; i < count; i++) NOAHZK_variable_width_mont_mul_primitive(table + i*width, table + (i - 1)*width, t, ctx->modulus.arr, ctx->n0_inv_neg, width);
+
+    memcpy(acc, ctx->r.arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    int first = 1;
+// i is the number of bits left; the window covers bits [j, i)
+    for(size_t i = NOAHZK_variable_width_pow_bitcnt_vartime(exponent->arr, exponent->width); i > 0;){
+        if(!NOAHZK_variable_width_get_bits_primitive(exponent->arr, exponent->width, i - 1, 1)){
+            NOAHZK_variable_width_mont_sqr_primitive(acc, acc, ctx->modulus.arr, ctx->n0_inv_neg, width);
+            i--;
+            continue;
+        }
+
+        size_t j = i > NOAHZK_POW_SLIDING_WINDOW? i - NOAHZK_POW_SLIDING_WINDOW: 0;
+        while(!NOAHZK_variable_width_get_bits_primitive(exponent->arr, exponent->width, j, 1)) j++;
+        const NOAHZK_limb_t* const entry = table + (NOAHZK_variable_width_get_bits_primitive(exponent->arr, exponent->width, j, i - j) >> 1)*width;
+
+// the first window is copied rather than multiplied into 1
+        if(first) memcpy(acc, entry, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+        else{
+            for(size_t k = j; k < i; k++) NOAHZK_variable_width_mont_sqr_primitive(acc, acc, ctx->modulus.arr, ctx->n0_inv_neg, width);
+            NOAHZK_variable_width_mont_mul_primitive(acc, acc, entry, ctx->modulus.arr, ctx->n0_inv_neg, width);
+        }
+        first = 0;
+        i = j;
+    }
+
+    NOAHZK_variable_width_pow_mod_finish(dst, acc, ctx, t);
+    NOAHZK_temporary_free(table, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+}
+
+// plain forms
+
+// dst = base^exponent, truncated to dst's width (i.e. mod 2^(dst->width*BITS_IN_NOAHZK_LIMB)); base is read as signed.
+// fixed-window like NOAHZK_variable_width_pow_mod, so it's constant-time for secret exponents. dst may alias base or exponent.
+void NOAHZK_variable_width_pow(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const base, const NOAHZK_variable_width_t* const exponent){
+    const size_t width = dst->width, count = (size_t)1 << NOAHZK_POW_WINDOW;
+    if(!width) return;
+    const size_t width_scratch = (count + 2)*width;
+    NOAHZK_limb_t* const table = NOAHZK_temporary_malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+    NOAHZK_limb_t* const acc = table + count*width, *const entry = acc + width;
+
+// table[i] = base^i; products past dst's width don't matter, so every multiplication is truncated to it
+    memset(table, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    table[0] = 1;
+    for(size_t i = 0; i < width; i++) table[width + i] = NOAHZK_variable_width_get_arr(base->arr, base->width, base->sign, i);
+    for(size_t i = 2; i < count; i++) NOAHZK_variable_width_mul_limb(table + i*width, table + (i - 1)*width, table + width, width, width, width);
+
+    memcpy(acc, table, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    const size_t windows = NOAHZK_SIZE_AS_ARR_OF_TYPE(exponent->width*BITS_IN_NOAHZK_LIMB, NOAHZK_POW_WINDOW);
+    for(size_t i = windows; i-- > 0;){
+        for(size_t j = 0; j < NOAHZK_POW_WINDOW; j++) NOAHZK_variable_width_sqr_limb(acc, acc, width, width);
+        NOAHZK_variable_width_select_from_table_primitive(entry, table, count, width, NOAHZK_variable_width_get_bits_primitive(exponent->arr, exponent->width, i*NOAHZK_POW_WINDOW, NOAHZK_POW_WINDOW));
+        NOAHZK_variable_width_mul_limb(acc, acc, entry, width, width, width);
+    }
+
+    memcpy(dst->arr, acc, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    NOAHZK_variable_width_update_sign(dst);
+    NOAHZK_temporary_free(table, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+}
+
+// not constant-time
+// 1 if src (width limbs, whose sign is sign) is 1 or -1, 0 otherwise
+int NOAHZK_variable_width_is_unit_vartime(const NOAHZK_limb_t* const src, const size_t width, const NOAHZK_limb_t sign){
+    return NOAHZK_variable_width_significant_width_vartime(src, width, sign) == 1 && src[0] == (sign? NOAHZK_LIMB_MAX: 1);
+}
+
+// not constant-time
+// limbs base^exponent takes up: exponent times base's significant width (see NOAHZK_variable_width_significant_width_vartime),
+// 1 if exponent is 0 or base is +-1, & 0 if base is 0. for any other base, returns SIZE_MAX if exponent is wider than 64 bits
+// or the width doesn't fit in a size_t, as such a power can't be held; callers have to refuse it rather than allocate for it.
+size_t NOAHZK_variable_width_pow_width_vartime(const NOAHZK_variable_width_t* const base, const NOAHZK_variable_width_t* const exponent){
+    const size_t bits = NOAHZK_variable_width_pow_bitcnt_vartime(exponent->arr, exponent->width);
+    const size_t width = NOAHZK_variable_width_significant_width_vartime(base->arr, base->width, base->sign);
+    if(!bits || NOAHZK_variable_width_is_unit_vartime(base->arr, base->width, base->sign)) return 1;
+    if(!width) return 0;
+    if(bits > BITS_IN_UINT64_T) return SIZE_MAX;
+
+    uint64_t k = 0;
+    for(size_t i = 0; i < NOAHZK_MIN(exponent->width, NOAHZK_SIZE_AS_ARR_OF_TYPE(sizeof(k), sizeof(NOAHZK_limb_t))); i++) k |= (uint64_t)exponent->arr[i] << (i*BITS_IN_NOAHZK_LIMB);
+    return k > SIZE_MAX/width? SIZE_MAX: (size_t)k*width;
+}
+
+// not constant-time; for public exponents only.
+// dst = base^exponent, the sliding-window core of the _and_resize form below; base is read as signed.
+// dst has to be able to hold NOAHZK_variable_width_pow_width_vartime(base, exponent) limbs, & ends up exactly that wide.
+// dst may alias base, but not exponent. base is cut down to its significant width & the multiplications are the _vartime ones.
+void NOAHZK_variable_width_pow_vartime_primitive(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const full_base, const NOAHZK_variable_width_t* const exponent){
+    NOAHZK_variable_width_t trimmed_base = *full_base;
+    trimmed_base.width = NOAHZK_variable_width_significant_width_vartime(full_base->arr, full_base->width, full_base->sign);
+    const NOAHZK_variable_width_t* const base = &trimmed_base;
+    const size_t bits = NOAHZK_variable_width_pow_bitcnt_vartime(exponent->arr, exponent->width);
+    if(!bits){
+        dst->arr[0] = 1;
+        dst->width = 1;
+        dst->sign = 0;
+        NOAHZK_variable_width_drop_bitcnt(dst);
+        return;
+    }
+    if(!base->width){
+        dst->width = 0;
+        dst->sign = 0;
+        NOAHZK_variable_width_drop_bitcnt(dst);
+        return;
+    }
+// +-1 to any power is +-1, by the exponent's parity; it's never squared, so an exponent wider than memory is fine
+    if(NOAHZK_variable_width_is_unit_vartime(base->arr, base->width, base->sign)){
+        const NOAHZK_limb_t sign = base->sign & NOAHZK_variable_width_get_bits_primitive(exponent->arr, exponent->width, 0, 1);
+        dst->arr[0] = sign? NOAHZK_LIMB_MAX: 1;
+        dst->width = 1;
+        dst->sign = sign;
+        NOAHZK_variable_width_drop_bitcnt(dst);
+        return;
+    }
+
+// table[i] = base^(2i + 1), (2i + 1)*base->width limbs wide; no more odd powers than the exponent can use
+    const size_t count = (size_t)1 << (NOAHZK_MIN(bits, NOAHZK_POW_SLIDING_WINDOW) - 1);
+    NOAHZK_variable_width_t table[(size_t)1 << (NOAHZK_POW_SLIDING_WINDOW - 1)], square;
+    NOAHZK_variable_width_init_temporary(&table[0], base->width);
+    memcpy(table[0].arr, base->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(base));
+    table[0].sign = base->sign;
+    NOAHZK_variable_width_init_temporary(&square, count > 1? 2*base->width: 0);
+    if(count > 1) NOAHZK_variable_width_square_primitive(&square, &table[0], square.width);
+    for(size_t i = 1; i < count; i++){
+        NOAHZK_variable_width_init_temporary(&table[i], (2*i + 1)*base->width);
+        NOAHZK_variable_width_mul_primitive_timed(&table[i], &table[i - 1], &square, table[i].width, NOAHZK_variable_width_variable_time);
+    }
+
+    int first = 1;
+    for(size_t i = bits; i > 0;){
+        if(!NOAHZK_variable_width_get_bits_primitive(exponent->arr, exponent->width, i - 1, 1)){
+            NOAHZK_variable_width_square_primitive(dst, dst, 2*dst->width);
+            i--;
+            continue;
+        }
+
+        size_t j = i > NOAHZK_POW_SLIDING_WINDOW? i - NOAHZK_POW_SLIDING_WINDOW: 0;
+        while(!NOAHZK_variable_width_get_bits_primitive(exponent->arr, exponent->width, j, 1)) j++;
+        const NOAHZK_variable_width_t* const entry = &table[NOAHZK_variable_width_get_bits_primitive(exponent->arr, exponent->width, j, i - j) >> 1];
+
+// starting from the first window rather than from 1 keeps dst exactly as wide as the power it holds
+        if(first){
+            memcpy(dst->arr, entry->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(entry));
+            dst->width = entry->width;
+            dst->sign = entry->sign;
+            NOAHZK_variable_width_drop_bitcnt(dst);
+        }
+        else{
+            for(size_t k = j; k < i; k++) NOAHZK_variable_width_square_primitive(dst, dst, 2*dst->width);
+            NOAHZK_variable_width_mul_primitive_timed(dst, dst, entry, dst->width + entry->width, NOAHZK_variable_width_variable_time);
+        }
+        first = 0;
+        i = j;
+    }
+
+    for(size_t i = 0; i < count; i++) NOAHZK_variable_width_destroy_temporary(&table[i]);
+    NOAHZK_variable_width_destroy_temporary(&square);
+}
+
+// dst = base^exponent, grown to hold the whole power; base is read as signed. dst may alias base, but not exponent.
+// returns 0 (& leaves dst as it is) if the power is too wide to hold (see NOAHZK_variable_width_pow_width_vartime), 1 otherwise.
+int NOAHZK_variable_width_pow_and_resize_vartime(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const base, const NOAHZK_variable_width_t* const exponent){
+    const size_t width = NOAHZK_variable_width_pow_width_vartime(base, exponent);
+    if(width == SIZE_MAX) return 0;
+
+    NOAHZK_variable_width_grow(dst, width);
+    NOAHZK_variable_width_pow_vartime_primitive(dst, base, exponent);
+    NOAHZK_variable_width_auto_trim(dst);
+    return 1;
+}
+
+// dst = rs0 * rs1**power, where power is an unsigned 64-bit integer.
+// returns 0 (& leaves dst as it is) if rs1**power is too wide to hold, 1 otherwise.
+int NOAHZK_variable_width_mul_to_power_and_resize_constant(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1, const uint64_t power){
+// a power of 0 or +-1 (power 0 included) makes dst 0 or +-rs0, so nothing is raised or multiplied; -rs0 may take a limb more than rs0
+    const int unit = !power || NOAHZK_variable_width_is_unit_vartime(rs1->arr, rs1->width, rs1->sign);
+    if(unit || !NOAHZK_variable_width_significant_width_vartime(rs1->arr, rs1->width, rs1->sign)){
+        const size_t width = unit? rs0->width + 1: 1;
+        NOAHZK_variable_width_grow(dst, width);
+        for(size_t i = 0; i < width; i++) dst->arr[i] = unit? (NOAHZK_limb_t)NOAHZK_variable_width_get_arr(rs0->arr, rs0->width, rs0->sign, i): 0;
+        NOAHZK_variable_width_negate_conditionally_primitive(dst->arr, dst->arr, width, unit & rs1->sign & power);
+        dst->width = width;
+        NOAHZK_variable_width_update_sign(dst);
+        NOAHZK_variable_width_auto_trim(dst);
+        return 1;
+    }
+
+// power is split into limbs by value, so it doesn't depend on the endianness of the machine
+    NOAHZK_limb_t power_arr[NOAHZK_SIZE_AS_ARR_OF_TYPE(sizeof(power), sizeof(NOAHZK_limb_t))];
+    for(size_t i = 0; i < sizeof(power_arr)/sizeof(NOAHZK_limb_t); i++) power_arr[i] = NOAHZK_get_section_from_var(power, NOAHZK_LIMB_MAX, i, NOAHZK_limb_t);
+    NOAHZK_variable_width_t exponent = NOAHZK_variable_width_INITIALISER;
+    exponent.arr = power_arr;
+    exponent.width = exponent.capacity = sizeof(power_arr)/sizeof(NOAHZK_limb_t);
+
+    const size_t width = NOAHZK_variable_width_pow_width_vartime(rs1, &exponent);
+    if(width == SIZE_MAX) return 0;
+
+    NOAHZK_variable_width_t product;
+    NOAHZK_variable_width_init_temporary(&product, width);
+    NOAHZK_variable_width_pow_vartime_primitive(&product, rs1, &exponent);
+
+    NOAHZK_variable_width_mul_and_resize(dst, rs0, &product);
+    NOAHZK_variable_width_destroy_temporary(&product);
+    return 1;
+}
+
+#endif
@@ -0,0 +1,463 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+#ifndef NOAHZK_bigint_radix_included
+#define NOAHZK_bigint_radix_included
+
+#include "definitions.h"    // NOAHZK variable-width type
+#include "alloc.h"          // NOAHZK_malloc, NOAHZK_temporary_malloc, NOAHZK_THREAD_LOCAL
+#include "logarithms.h"     // NOAHZK_min_bitcnt_var, NOAHZK_variable_width_bitcnt_vartime_primitive
+#include "logic.h"          // NOAHZK_variable_width_negate_conditionally_primitive
+#include "add.h"            // NOAHZK_variable_width_add_primitive
+#include "sub.h"            // NOAHZK_variable_width_sub_primitive
+#include "mul.h"            // NOAHZK_variable_width_mul_dispatch_scratch
+#include "shift.h"          // NOAHZK_variable_width_shift_left_primitive
+#include "div.h"            // NOAHZK_variable_width_reciprocal_vartime_primitive, NOAHZK_variable_width_div_store
+#include "workspace.h"      // NOAHZK_default_workspace_get
+#include "stdint.h"         // integer types
+#include "string.h"         // memset, memcpy, memmove, strlen
+
+// conversion to & from decimal & hex strings. none of it is constant-time; it's for public values, like the _vartime ops.
+// hex is linear either way. decimal is divide & conquer over the powers P_j = 10^(d*2^j), where 10^d is the largest power of 10 that fits
+// in a limb: a value of n digits is split into the quotient & remainder by the P_j with n/2 <= d*2^j < n, & each half is converted on its own.
+// with every P_j's reciprocal precomputed, each split takes two multiplications, so converting costs O(M(n) log n) instead of O(n^2).
+// the P_j & their reciprocals are cached per thread, like the default workspace, & only grow; NOAHZK_radix_powers_release frees them.
+// strings are written to caller-supplied buffers; the _scratch variants take their temporaries from a caller-supplied buffer too.
+
+// tunable threshold, in limbs, below which decimal conversion is done a limb's worth of digits at a time instead of by divide & conquer
+#ifndef NOAHZK_RADIX_DC_THRESHOLD
+#define NOAHZK_RADIX_DC_THRESHOLD 16
+#endif
+#if NOAHZK_RADIX_DC_THRESHOLD < 1
+#error "NOAHZK_RADIX_DC_THRESHOLD has to be at least 1"
+#endif
+
+#if NOAHZK_LIMB_BITS == 64
+#define NOAHZK_RADIX_DEC_DIGITS 19                          // d, digits per limb
+#define NOAHZK_RADIX_DEC_BASE   10000000000000000000ull     // 10^d
+#else
+#define NOAHZK_RADIX_DEC_DIGITS 9
+#define NOAHZK_RADIX_DEC_BASE   1000000000ul
+#endif
+
+// deepest P_j the cache can hold; d*2^48 digits is more than memory can
+#define NOAHZK_RADIX_MAX_LEVELS 48
+
+typedef struct{
+    size_t width;               // k, the width of P_j in limbs
+    size_t shift;               // how far P_j is shifted left to normalise it
+    size_t digits;              // d*2^j
+    NOAHZK_limb_t* power;       // P_j, k limbs wide
+    NOAHZK_limb_t* normalised;  // P_j << shift, whose top bit is set
+    NOAHZK_limb_t* mu;          // floor(B^2k/normalised), k + 1 limbs wide
+} NOAHZK_radix_power_t;
+
+typedef struct{
+    size_t count;
+    NOAHZK_radix_power_t levels[NOAHZK_RADIX_MAX_LEVELS];
+} NOAHZK_radix_powers_t;
+
+NOAHZK_THREAD_LOCAL NOAHZK_radix_powers_t NOAHZK_radix_powers = {0};
+
+// upper bound on the decimal digits of a value bits bits wide; 1234/4096 is just above log10(2)
+size_t NOAHZK_radix_dec_digits_bound(const size_t bits){
+    return bits*1234/4096 + 1;
+}
+
+// upper bound on the limbs a value of digits decimal digits takes; 1701/512 is just above log2(10)
+size_t NOAHZK_radix_dec_width_bound(const size_t digits){
+    return digits*1701/512/BITS_IN_NOAHZK_LIMB + 1;
+}
+
+// index of the P_j a value of digits digits is split by: the smallest j with 2*d*2^j >= digits
+size_t NOAHZK_radix_dec_level(const size_t digits){
+    size_t level = 0;
+    while(2*((size_t)NOAHZK_RADIX_DEC_DIGITS << level) < digits) level++;
+    return level;
+}
+
+// makes sure the calling thread's cache holds every P_j needed to convert values of up to digits decimal digits.
+// each P_j is the square of the one below it; its reciprocal is found by Newton's iteration.
+void NOAHZK_radix_powers_reserve(const size_t digits){
+    if(digits <= NOAHZK_RADIX_DC_THRESHOLD*NOAHZK_RADIX_DEC_DIGITS) return;
+    const size_t count = NOAHZK_radix_dec_level(digits) + 1;
+
+    while(NOAHZK_radix_powers.count < count){
+        NOAHZK_radix_power_t* const level = &NOAHZK_radix_powers.levels[NOAHZK_radix_powers.count];
+        const NOAHZK_radix_power_t* const below = NOAHZK_radix_powers.count? level - 1: NULL;
+
+// P_0 is a single limb; P_j is P_(j - 1)^2, which is 2k or 2k - 1 limbs wide
+        const size_t width_square = below? 2*below->width: 1;
+        const size_t width_reciprocal = NOAHZK_MAX(NOAHZK_variable_width_reciprocal_vartime_scratch_size(width_square), NOAHZK_variable_width_reciprocal_vartime_scratch_size(width_square - 1));
+        const size_t width_scratch = width_square + NOAHZK_MAX(below? NOAHZK_variable_width_mul_dispatch_scratch_size(below->width, below->width): 0, width_reciprocal);
+        NOAHZK_limb_t* const square = NOAHZK_temporary_malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+        NOAHZK_limb_t* const scratch = square + width_square;
+        if(below) NOAHZK_variable_width_mul_dispatch_scratch(square, below->power, below->power, below->width, below->width, scratch);
+        else square[0] = (NOAHZK_limb_t)NOAHZK_RADIX_DEC_BASE;
+
+        size_t width = width_square;
+        while(!square[width - 1]) width--;
+
+        level->width = width;
+        level->shift = BITS_IN_NOAHZK_LIMB - NOAHZK_min_bitcnt_var(square[width - 1]);
+        level->digits = (size_t)NOAHZK_RADIX_DEC_DIGITS << NOAHZK_radix_powers.count;
+        level->power = NOAHZK_malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(3*width + 1));
+        level->normalised = level->power + width;
+        level->mu = level->normalised + width;
+        memcpy(level->power, square, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+        NOAHZK_variable_width_shift_left_primitive(level->normalised, square, width, width, 0, level->shift);
+        NOAHZK_variable_width_reciprocal_vartime_primitive(level->mu, level->normalised, width, scratch);
+
+        NOAHZK_temporary_free(square, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_scratch));
+        NOAHZK_radix_powers.count++;
+    }
+}
+
+// frees the calling thread's cached powers; call it before the thread exits.
+void NOAHZK_radix_powers_release(void){
+    for(size_t i = 0; i < NOAHZK_radix_powers.count; i++){
+        NOAHZK_radix_power_t* const level = &NOAHZK_radix_powers.levels[i];
+        NOAHZK_free(level->power, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(3*level->width + 1));
+    }
+    NOAHZK_radix_powers.count = 0;
+}
+
+// decimal formatting
+
+// limbs of scratch NOAHZK_variable_width_dec_format_primitive needs for digits digits.
+// each split keeps its quotient & remainder (2k + 2 limbs) while the halves are converted, & needs 4k + 2 more for the division itself;
+// as with the multiplication tiers, following the widest half down bounds every depth.
+size_t NOAHZK_variable_width_dec_format_scratch_size(size_t digits){
+    size_t width_scratch = 0, width_kept = 0;
+    while(digits > NOAHZK_RADIX_DC_THRESHOLD*NOAHZK_RADIX_DEC_DIGITS){
+        const size_t split = (size_t)NOAHZK_RADIX_DEC_DIGITS << NOAHZK_radix_dec_level(digits);
+        const size_t k = NOAHZK_radix_dec_width_bound(split + 1);
+        width_kept += 2*k + 2;
+        width_scratch = NOAHZK_MAX(width_scratch, width_kept + 4*k + 2 + NOAHZK_variable_width_mul_limb_scratch_size(k + 1, k + 1));
+        digits = split;
+    }
+    return NOAHZK_MAX(width_scratch, width_kept + NOAHZK_radix_dec_width_bound(digits));
+}
+
+// writes the digits decimal digits of the unsigned value in src, width limbs wide, to dst, padded with leading zeros; src has to be below 10^digits.
+// src isn't written to. the powers for digits digits have to be in the cache (NOAHZK_radix_powers_reserve).
+// scratch has to be NOAHZK_variable_width_dec_format_scratch_size(digits) limbs wide.
+void NOAHZK_variable_width_dec_format_primitive(char* const dst, const size_t digits, const NOAHZK_limb_t* const src, size_t width, NOAHZK_limb_t* const scratch){
+    while(width && !src[width - 1]) width--;
+
+// a limb's worth of digits at a time, by dividing by 10^d
+    if(digits <= NOAHZK_RADIX_DC_THRESHOLD*NOAHZK_RADIX_DEC_DIGITS){
+        NOAHZK_limb_t* const x = scratch;
+        memcpy(x, src, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+        size_t written = digits;
+        while(written && width){
+            NOAHZK_expanded_limb_t r = 0;
+            for(size_t i = width; i-- > 0;){
+                const NOAHZK_expanded_limb_t z = r << BITS_IN_NOAHZK_LIMB | x[i];
+                x[i] = (NOAHZK_limb_t)(z/NOAHZK_RADIX_DEC_BASE);
+                r = z%NOAHZK_RADIX_DEC_BASE;
+            }
+            if(!x[width - 1]) width--;
+
+            for(size_t i = 0; i < NOAHZK_RADIX_DEC_DIGITS && written; i++){
+                dst[--written] = '0' + (char)(r%10);
+                r /= 10;
+            }
+        }
+        memset(dst, '0', written);
+        return;
+    }
+
+    const NOAHZK_radix_power_t* const level = &NOAHZK_radix_powers.levels[NOAHZK_radix_dec_level(digits)];
+    const size_t k = level->width, digits_high = digits - level->digits;
+
+// below P_j, the quotient is 0
+    if(width < k){
+        memset(dst, '0', digits_high);
+        NOAHZK_variable_width_dec_format_primitive(dst + digits_high, level->digits, src, width, scratch);
+        return;
+    }
+
+// src < 10^digits <= P_j^2, so shifted it's still below B^2k.
+// q = floor(floor(x/B^(k-1))*mu/B^(k+1)) is at most 2 short of x/P_j, as in NOAHZK_variable_width_barrett_reduce; r = x - q*P_j, shifted
+    NOAHZK_limb_t* const q = scratch, *const r = q + k + 1, *const x = r + k + 1, *const product = x + 2*k, *const scratch_mul = product + 2*k + 2;
+    NOAHZK_variable_width_shift_left_primitive(x, src, 2*k, width, 0, level->shift);
+    NOAHZK_variable_width_mul_dispatch_scratch(product, x + k - 1, level->mu, k + 1, k + 1, scratch_mul);
+    memcpy(q, product + k + 1, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(k + 1));
+    NOAHZK_variable_width_mul_limb_scratch(product, q, level->normalised, k + 1, k, k + 1, scratch_mul);
+    NOAHZK_variable_width_sub_primitive(r, x, product, k + 1, k + 1, k + 1, 0, 0);
+    while(NOAHZK_variable_width_sub_primitive(product, r, level->normalised, k + 1, k + 1, k, 0, 0)){
+        memcpy(r, product, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(k + 1));
+        NOAHZK_variable_width_add_constant_primitive(q, q, 1, k + 1, k + 1, 0);
+    }
+    NOAHZK_variable_width_shift_right_primitive(r, r, k + 1, k + 1, 0, level->shift);
+
+    NOAHZK_variable_width_dec_format_primitive(dst + digits_high, level->digits, r, k, x);
+    NOAHZK_variable_width_dec_format_primitive(dst, digits_high, q, k + 1, x);
+}
+
+// chars dst needs for src in decimal, counting the sign & the terminating null; it's a bound, so the string may be shorter.
+size_t NOAHZK_variable_width_to_dec_size(const NOAHZK_variable_width_t* const src){
+    return NOAHZK_radix_dec_digits_bound(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR_BITS(src)) + 2;
+}
+
+size_t NOAHZK_variable_width_to_dec_scratch_size(const NOAHZK_variable_width_t* const src){
+    return src->width + NOAHZK_variable_width_dec_format_scratch_size(NOAHZK_radix_dec_digits_bound(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR_BITS(src)));
+}
+
+// writes src in decimal to dst, null-terminated, with a leading '-' if it's negative.
+// size is dst's size in chars, which has to be at least NOAHZK_variable_width_to_dec_size(src); returns the length of the string,
+// or 0 (writing nothing) if dst is too small. the powers are taken from the cache, which is grown if it has to be.
+// scratch has to be NOAHZK_variable_width_to_dec_scratch_size(src) limbs wide.
+size_t NOAHZK_variable_width_to_dec_scratch(char* const dst, const size_t size, const NOAHZK_variable_width_t* const src, NOAHZK_limb_t* const scratch){
+    if(size < NOAHZK_variable_width_to_dec_size(src)) return 0;
+
+    const size_t width = src->width;
+    const NOAHZK_limb_t sign = width? src->sign: 0;
+    NOAHZK_limb_t* const x = scratch;
+    NOAHZK_variable_width_negate_conditionally_primitive(x, src->arr, width, sign);
+
+    size_t width_trimmed = width;
+    while(width_trimmed && !x[width_trimmed - 1]) width_trimmed--;
+    const size_t bits = NOAHZK_variable_width_bitcnt_vartime_primitive(x, width_trimmed);
+    const size_t digits = NOAHZK_radix_dec_digits_bound(bits);
+    NOAHZK_radix_powers_reserve(digits);
+
+    char* const digit = dst + sign;
+    NOAHZK_variable_width_dec_format_primitive(digit, digits, x, width_trimmed, scratch + width);
+
+    size_t zeros = 0;
+    while(zeros + 1 < digits && digit[zeros] == '0') zeros++;
+    memmove(digit, digit + zeros, digits - zeros);
+    if(sign) dst[0] = '-';
+    dst[sign + digits - zeros] = '\0';
+    return sign + digits - zeros;
+}
+
+// same as above, with scratch from the default workspace
+size_t NOAHZK_variable_width_to_dec(char* const dst, const size_t size, const NOAHZK_variable_width_t* const src){
+    NOAHZK_radix_powers_reserve(NOAHZK_radix_dec_digits_bound(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR_BITS(src)));
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_to_dec_scratch_size(src));
+    return NOAHZK_variable_width_to_dec_scratch(dst, size, src, scratch);
+}
+
+// decimal parsing
+
+// limbs of scratch NOAHZK_variable_width_dec_parse_primitive needs for digits digits.
+// each split keeps both halves & their product (at most 4k limbs) while the halves are parsed.
+size_t NOAHZK_variable_width_dec_parse_scratch_size(size_t digits){
+    size_t width_scratch = 0, width_kept = 0;
+    while(digits > NOAHZK_RADIX_DC_THRESHOLD*NOAHZK_RADIX_DEC_DIGITS){
+        const size_t split = (size_t)NOAHZK_RADIX_DEC_DIGITS << NOAHZK_radix_dec_level(digits);
+        const size_t k = NOAHZK_radix_dec_width_bound(split + 1);
+        width_kept += 4*k;
+        width_scratch = NOAHZK_MAX(width_scratch, width_kept + NOAHZK_variable_width_mul_dispatch_scratch_size(k, k));
+        digits = split;
+    }
+    return NOAHZK_MAX(width_scratch, width_kept);
+}
+
+// dst = the value of the digits decimal digits in src, which all have to be '0' to '9'; writes NOAHZK_radix_dec_width_bound(digits) limbs of dst.
+// the powers for digits digits have to be in the cache (NOAHZK_radix_powers_reserve).
+// scratch has to be NOAHZK_variable_width_dec_parse_scratch_size(digits) limbs wide.
+void NOAHZK_variable_width_dec_parse_primitive(NOAHZK_limb_t* const dst, const char* const src, const size_t digits, NOAHZK_limb_t* const scratch){
+    const size_t width_dst = NOAHZK_radix_dec_width_bound(digits);
+    memset(dst, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_dst));
+
+// dst = dst*10^d + the next d digits, a limb's worth at a time; the first chunk takes what's left over
+    if(digits <= NOAHZK_RADIX_DC_THRESHOLD*NOAHZK_RADIX_DEC_DIGITS){
+        size_t width = 0, read = 0;
+        while(read < digits){
+            const size_t chunk = read? NOAHZK_RADIX_DEC_DIGITS: (digits - 1)%NOAHZK_RADIX_DEC_DIGITS + 1;
+            NOAHZK_limb_t value = 0, power = 1;
+            for(size_t i = 0; i < chunk; i++){
+                value = value*10 + (NOAHZK_limb_t)(src[read + i] - '0');
+                power *= 10;
+            }
+            read += chunk;
+
+            NOAHZK_limb_t carry = value;
+            for(size_t i = 0; i < width; i++){
+                const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)dst[i]*power + carry;
+                dst[i] = z & NOAHZK_LIMB_MAX;
+                carry = z >> BITS_IN_NOAHZK_LIMB;
+            }
+            if(carry) dst[width++] = carry;
+        }
+        return;
+    }
+
+// dst = high*P_j + low
+    const NOAHZK_radix_power_t* const level = &NOAHZK_radix_powers.levels[NOAHZK_radix_dec_level(digits)];
+    const size_t digits_high = digits - level->digits;
+    const size_t width_high = NOAHZK_radix_dec_width_bound(digits_high), width_low = NOAHZK_radix_dec_width_bound(level->digits);
+    NOAHZK_limb_t* const high = scratch, *const low = high + width_high, *const product = low + width_low, *const scratch_next = product + width_high + level->width;
+    NOAHZK_variable_width_dec_parse_primitive(high, src, digits_high, scratch_next);
+    NOAHZK_variable_width_dec_parse_primitive(low, src + digits_high, level->digits, scratch_next);
+
+    size_t width = width_high;
+    while(width && !high[width - 1]) width--;
+    if(width){
+        const size_t width_product = width + level->width;
+        NOAHZK_variable_width_mul_dispatch_scratch(product, high, level->power, width, level->width, scratch_next);
+        memcpy(dst, product, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(NOAHZK_MIN(width_dst, width_product)));
+    }
+    NOAHZK_variable_width_add_primitive(dst, dst, low, width_dst, width_dst, width_low, 0, 0);
+}
+
+// number of digits in src, if it's a valid decimal string: an optional '-', then at least one digit & nothing else. 0 otherwise.
+// *start is set to the index of the first digit.
+size_t NOAHZK_variable_width_dec_validate(const char* const src, size_t* const start){
+    const size_t first = src[0] == '-';
+    size_t digits = 0;
+    while(src[first + digits] >= '0' && src[first + digits] <= '9') digits++;
+    if(src[first + digits] != '\0') return 0;
+
+    *start = first;
+    return digits;
+}
+
+// limbs of scratch NOAHZK_variable_width_from_dec_scratch needs for a string length chars long
+size_t NOAHZK_variable_width_from_dec_scratch_size(const size_t length){
+    return NOAHZK_radix_dec_width_bound(length) + NOAHZK_variable_width_dec_parse_scratch_size(length);
+}
+
+// dst = the value of the decimal string src (an optional '-', then digits), truncated to dst's width.
+// returns 1, or 0 (leaving dst as it is) if src isn't a valid decimal string. the powers are taken from the cache, which is grown if it has to be.
+// scratch has to be NOAHZK_variable_width_from_dec_scratch_size(strlen(src)) limbs wide.
+int NOAHZK_variable_width_from_dec_scratch(NOAHZK_variable_width_t* const dst, const char* const src, NOAHZK_limb_t* const scratch){
+    size_t start = 0, digits = NOAHZK_variable_width_dec_validate(src, &start);
+    if(!digits) return 0;
+// leading zeros only make the split deeper
+    while(digits > 1 && src[start] == '0'){
+        start++;
+        digits--;
+    }
+
+    NOAHZK_radix_powers_reserve(digits);
+    const size_t width = NOAHZK_radix_dec_width_bound(digits);
+    NOAHZK_variable_width_dec_parse_primitive(scratch, src + start, digits, scratch + width);
+    NOAHZK_variable_width_div_store(dst, scratch, width, src[0] == '-');
+    return 1;
+}
+
+// same as above, with scratch from the default workspace
+int NOAHZK_variable_width_from_dec(NOAHZK_variable_width_t* const dst, const char* const src){
+    const size_t length = strlen(src);
+    NOAHZK_radix_powers_reserve(length);
+    NOAHZK_limb_t* const scratch = NOAHZK_default_workspace_get(NOAHZK_variable_width_from_dec_scratch_size(length));
+    return NOAHZK_variable_width_from_dec_scratch(dst, src, scratch);
+}
+
+// same as above, but resizes dst so it holds the value whole, with room for its sign.
+int NOAHZK_variable_width_from_dec_and_resize(NOAHZK_variable_width_t* const dst, const char* const src){
+    size_t start = 0;
+    const size_t digits = NOAHZK_variable_width_dec_validate(src, &start);
+    if(!digits) return 0;
+
+    const size_t width = NOAHZK_radix_dec_width_bound(digits) + 1;
+    NOAHZK_variable_width_grow(dst, width);
+    dst->width = width;
+    const int valid = NOAHZK_variable_width_from_dec(dst, src);
+    NOAHZK_variable_width_auto_trim(dst);
+    return valid;
+}
+
+// hex
+
+// value of the hex digit c, or 16 if it isn't one
+NOAHZK_limb_t NOAHZK_radix_hex_digit(const char c){
+    if(c >= '0' && c <= '9') return (NOAHZK_limb_t)(c - '0');
+    if(c >= 'a' && c <= 'f') return (NOAHZK_limb_t)(c - 'a' + 10);
+    if(c >= 'A' && c <= 'F') return (NOAHZK_limb_t)(c - 'A' + 10);
+    return 16;
+}
+
+// chars dst needs for src in hex, counting the sign & the terminating null
+size_t NOAHZK_variable_width_to_hex_size(const NOAHZK_variable_width_t* const src){
+    return NOAHZK_MAX(src->width*2*sizeof(NOAHZK_limb_t), 1) + 2;
+}
+
+// writes src in lowercase hex, without a prefix, to dst, null-terminated, with a leading '-' if it's negative.
+// size is dst's size in chars, which has to be at least NOAHZK_variable_width_to_hex_size(src); returns the length of the string,
+// or 0 (writing nothing) if dst is too small. the absolute value is taken a limb at a time, so nothing is allocated.
+size_t NOAHZK_variable_width_to_hex(char* const dst, const size_t size, const NOAHZK_variable_width_t* const src){
+    if(size < NOAHZK_variable_width_to_hex_size(src)) return 0;
+
+    const size_t width = src->width, nibbles = 2*sizeof(NOAHZK_limb_t), digits = NOAHZK_MAX(width*nibbles, 1);
+    const NOAHZK_limb_t sign = width? src->sign: 0;
+    char* const digit = dst + sign;
+    digit[0] = '0';
+
+// the digits are written from the bottom up, as the carry of the negation goes that way
+    NOAHZK_limb_t carry = sign;
+    for(size_t i = 0; i < width; i++){
+        const NOAHZK_expanded_limb_t z = (NOAHZK_expanded_limb_t)NOAHZK_variable_width_conditionally_invert(src->arr[i], sign) + carry;
+        NOAHZK_limb_t limb = z & NOAHZK_LIMB_MAX;
+        carry = NOAHZK_variable_width_get_out(z);
+        for(size_t j = 0; j < nibbles; j++){
+            digit[digits - 1 - i*nibbles - j] = "0123456789abcdef"[limb & 0xf];
+            limb >>= 4;
+        }
+    }
+
+    size_t zeros = 0;
+    while(zeros + 1 < digits && digit[zeros] == '0') zeros++;
+    memmove(digit, digit + zeros, digits - zeros);
+    if(sign) dst[0] = '-';
+    dst[sign + digits - zeros] = '\0';
+    return sign + digits - zeros;
+}
+
+// number of digits in src, if it's a valid hex string: an optional '-', an optional "0x" or "0X", then at least one digit & nothing else.
+// 0 otherwise. *start is set to the index of the first digit.
+size_t NOAHZK_variable_width_hex_validate(const char* const src, size_t* const start){
+    size_t first = src[0] == '-';
+    if(src[first] == '0' && (src[first + 1] == 'x' || src[first + 1] == 'X')) first += 2;
+    size_t digits = 0;
+    while(NOAHZK_radix_hex_digit(src[first + digits]) < 16) digits++;
+    if(src[first + digits] != '\0') return 0;
+
+    *start = first;
+    return digits;
+}
+
+// dst = the value of the hex string src, truncated to dst's width.
+// returns 1, or 0 (leaving dst as it is) if src isn't a valid hex string.
+int NOAHZK_variable_width_from_hex(NOAHZK_variable_width_t* const dst, const char* const src){
+    size_t start = 0;
+    const size_t digits = NOAHZK_variable_width_hex_validate(src, &start);
+    if(!digits) return 0;
+
+    const size_t nibbles = 2*sizeof(NOAHZK_limb_t);
+    if(dst->width) memset(dst->arr, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(dst));
+    for(size_t i = 0; i < digits && i/nibbles < dst->width; i++){
+        dst->arr[i/nibbles] |= NOAHZK_radix_hex_digit(src[start + digits - 1 - i]) << (4*(i%nibbles));
+    }
+
+    NOAHZK_variable_width_negate_conditionally_primitive(dst->arr, dst->arr, dst->width, src[0] == '-');
+    dst->sign = dst->width? NOAHZK_variable_width_get_sign(dst): 0;
+    NOAHZK_variable_width_drop_bitcnt(dst);
+    return 1;
+}
+
+// same as above, but resizes dst so it holds the value whole, with room for its sign.
+int NOAHZK_variable_width_from_hex_and_resize(NOAHZK_variable_width_t* const dst, const char* const src){
+    size_t start = 0;
+    const size_t digits = NOAHZK_variable_width_hex_validate(src, &start);
+    if(!digits) return 0;
+
+    const size_t width = NOAHZK_SIZE_AS_ARR_OF_TYPE(digits, 2*sizeof(NOAHZK_limb_t)) + 1;
+    NOAHZK_variable_width_grow(dst, width);
+    dst->width = width;
+    const int valid = NOAHZK_variable_width_from_hex(dst, src);
+    NOAHZK_variable_width_auto_trim(dst);
+    return valid;
+}
+
+#endif
@@ -0,0 +1,187 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+#ifndef NOAHZK_bigint_shift_included
+#define NOAHZK_bigint_shift_included
+
+#include "definitions.h"    // NOAHZK variable-width type
+#include "logarithms.h"     // NOAHZK_min_bitcnt_var
+#include "workspace.h"      // scratch for the barrel shifters
+#include "stdint.h"         // integer types
+#include "string.h"         // memcpy
+
+// shifts move whole limbs, funnelling the bits that cross a limb boundary in from the neighbouring limb,
+// so a shift costs one pass over dst whatever shamt is.
+// the right shifts fill in the sign passed to them: 0 for a logical shift, the source's sign for an arithmetic one.
+// sources are read as extended by their sign past their width, like everywhere else.
+
+// funnel shifts of the two-limb value hi:lo, for 0 <= shamt < BITS_IN_NOAHZK_LIMB
+NOAHZK_limb_t NOAHZK_variable_width_funnel_left(const NOAHZK_limb_t hi, const NOAHZK_limb_t lo, const size_t shamt){
+    return (NOAHZK_limb_t)((((NOAHZK_expanded_limb_t)hi << BITS_IN_NOAHZK_LIMB | lo) << shamt) >> BITS_IN_NOAHZK_LIMB);
+}
+
+NOAHZK_limb_t NOAHZK_variable_width_funnel_right(const NOAHZK_limb_t hi, const NOAHZK_limb_t lo, const size_t shamt){
+    return (NOAHZK_limb_t)((((NOAHZK_expanded_limb_t)hi << BITS_IN_NOAHZK_LIMB | lo) >> shamt) & NOAHZK_LIMB_MAX);
+}
+
+// only constant-time if shamt is.
+// dst = src << shamt, truncated to width_dst limbs. dst may alias src.
+void NOAHZK_variable_width_shift_left_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const size_t width_dst, const size_t width_src, const NOAHZK_limb_t sign, const size_t shamt){
+    const size_t limbs = shamt/BITS_IN_NOAHZK_LIMB, bits = shamt%BITS_IN_NOAHZK_LIMB;
+// top-down, so every limb is read before it's overwritten when dst aliases src
+    for(size_t i = width_dst; i-- > 0;){
+        const NOAHZK_limb_t hi = i >= limbs? (NOAHZK_limb_t)NOAHZK_variable_width_get_arr(src, width_src, sign, i - limbs): 0;
+        const NOAHZK_limb_t lo = i >= limbs + 1? (NOAHZK_limb_t)NOAHZK_variable_width_get_arr(src, width_src, sign, i - limbs - 1): 0;
+        dst[i] = NOAHZK_variable_width_funnel_left(hi, lo, bits);
+    }
+}
+
+// only constant-time if shamt is.
+// dst = src >> shamt, truncated to width_dst limbs, with sign shifted in from the top. dst may alias src.
+void NOAHZK_variable_width_shift_right_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const size_t width_dst, const size_t width_src, const NOAHZK_limb_t sign, const size_t shamt){
+    const size_t limbs = shamt/BITS_IN_NOAHZK_LIMB, bits = shamt%BITS_IN_NOAHZK_LIMB;
+// bottom-up, for the same reason
+    for(size_t i = 0; i < width_dst; i++){
+        const NOAHZK_limb_t lo = (NOAHZK_limb_t)NOAHZK_variable_width_get_arr(src, width_src, sign, i + limbs);
+        const NOAHZK_limb_t hi = (NOAHZK_limb_t)NOAHZK_variable_width_get_arr(src, width_src, sign, i + limbs + 1);
+        dst[i] = NOAHZK_variable_width_funnel_right(hi, lo, bits);
+    }
+}
+
+// barrel shifters, for secret shift amounts: shamt is applied one bit at a time, each stage shifting by its power of two
+// & keeping the result by mask, so the work only depends on the widths. amounts past the width give 0 (or -1, for a negative arithmetic shift).
+
+// limbs of scratch the barrel shifters need
+size_t NOAHZK_variable_width_shift_barrel_scratch_size(const size_t width_dst, const size_t width_src){
+    return 2*NOAHZK_MAX(width_dst, width_src);
+}
+
+// constant-time, as long as width_dst & width_src are
+// dst = src << shamt if left, src >> shamt with sign shifted in otherwise, truncated to width_dst limbs. dst may alias src.
+// scratch has to be NOAHZK_variable_width_shift_barrel_scratch_size(width_dst, width_src) limbs wide.
+void NOAHZK_variable_width_shift_barrel_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const src, const size_t width_dst, const size_t width_src, const NOAHZK_limb_t sign, const size_t shamt, const int left, NOAHZK_limb_t* const scratch){
+    const size_t width = NOAHZK_MAX(width_dst, width_src);
+    NOAHZK_limb_t* const acc = scratch, *const shifted = scratch + width;
+    for(size_t i = 0; i < width; i++) acc[i] = (NOAHZK_limb_t)NOAHZK_variable_width_get_arr(src, width_src, sign, i);
+
+// every stage up to the one that shifts by the whole width; any bit of shamt above those empties acc
+    const size_t stages = width? NOAHZK_min_bitcnt_var(width*BITS_IN_NOAHZK_LIMB): 0;
+    for(size_t stage = 0; stage < stages; stage++){
+        if(left) NOAHZK_variable_width_shift_left_primitive(shifted, acc, width, width, 0, (size_t)1 << stage);
+        else NOAHZK_variable_width_shift_right_primitive(shifted, acc, width, width, sign, (size_t)1 << stage);
+
+        const NOAHZK_limb_t mask = -(NOAHZK_limb_t)(shamt >> stage & 1);
+        for(size_t i = 0; i < width; i++) acc[i] = (shifted[i] & mask) | (acc[i] & ~mask);
+    }
+
+    const size_t bits_in_size_t = sizeof(size_t)*BITS_IN_UINT8_T;
+    const size_t high = stages < bits_in_size_t? shamt >> stages: 0;
+    const NOAHZK_limb_t out = -(NOAHZK_limb_t)((high | -high) >> (bits_in_size_t - 1)), fill = left? 0: -sign;
+    for(size_t i = 0; i < width_dst; i++) dst[i] = (fill & out) | (acc[i] & ~out);
+}
+
+// ops over variable-width vars. dst keeps its width in the fixed-width forms & has its sign set from its top bit;
+// the _and_resize forms resize dst so that no bits are lost (the right shifts only drop the limbs shifted out).
+
+void NOAHZK_variable_width_shift_update_sign(NOAHZK_variable_width_t* const dst){
+    dst->sign = dst->width? NOAHZK_variable_width_get_sign(dst): 0;
+    NOAHZK_variable_width_drop_bitcnt(dst);
+}
+
+// only constant-time if shamt is.
+void NOAHZK_variable_width_shift_left(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const size_t shamt){
+    NOAHZK_variable_width_shift_left_primitive(dst->arr, src->arr, dst->width, src->width, src->sign, shamt);
+    NOAHZK_variable_width_shift_update_sign(dst);
+}
+
+// only constant-time if shamt is.
+// logical: the bits above src's width are read as 0, whatever its sign.
+void NOAHZK_variable_width_shift_right(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const size_t shamt){
+    NOAHZK_variable_width_shift_right_primitive(dst->arr, src->arr, dst->width, src->width, 0, shamt);
+    NOAHZK_variable_width_shift_update_sign(dst);
+}
+
+// only constant-time if shamt is.
+void NOAHZK_variable_width_shift_right_arithmetic(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const size_t shamt){
+    NOAHZK_variable_width_shift_right_primitive(dst->arr, src->arr, dst->width, src->width, src->sign, shamt);
+    NOAHZK_variable_width_shift_update_sign(dst);
+}
+
+// not constant-time
+// dst = src << shamt, src->width + ceil(shamt/BITS_IN_NOAHZK_LIMB) limbs wide, with src's sign
+void NOAHZK_variable_width_shift_left_and_resize(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const size_t shamt){
+    const size_t width_src = src->width, width = width_src + NOAHZK_SIZE_AS_ARR_OF_TYPE(shamt, BITS_IN_NOAHZK_LIMB);
+    const NOAHZK_limb_t sign = src->sign;
+    NOAHZK_variable_width_grow(dst, width);
+    NOAHZK_variable_width_shift_left_primitive(dst->arr, dst == src? dst->arr: src->arr, width, width_src, sign, shamt);
+    dst->width = width;
+    dst->sign = sign;
+    NOAHZK_variable_width_drop_bitcnt(dst);
+    NOAHZK_variable_width_auto_trim(dst);
+}
+
+// not constant-time
+// dst = src >> shamt, logical, without the limbs that are shifted out entirely. dst's sign is 0.
+void NOAHZK_variable_width_shift_right_and_resize(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const size_t shamt){
+    const size_t limbs = shamt/BITS_IN_NOAHZK_LIMB, width_src = src->width, width = width_src > limbs? width_src - limbs: 0;
+    NOAHZK_variable_width_grow(dst, width);
+    NOAHZK_variable_width_shift_right_primitive(dst->arr, dst == src? dst->arr: src->arr, width, width_src, 0, shamt);
+    dst->width = width;
+    dst->sign = 0;
+    NOAHZK_variable_width_drop_bitcnt(dst);
+    NOAHZK_variable_width_auto_trim(dst);
+}
+
+// not constant-time
+// dst = src >> shamt, arithmetic, without the limbs that are shifted out entirely (a limb is kept for -1). dst has src's sign.
+void NOAHZK_variable_width_shift_right_arithmetic_and_resize(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const size_t shamt){
+    const size_t limbs = shamt/BITS_IN_NOAHZK_LIMB, width_src = src->width;
+    const size_t width = width_src > limbs? width_src - limbs: NOAHZK_MIN(width_src, src->sign);
+    const NOAHZK_limb_t sign = src->sign;
+    NOAHZK_variable_width_grow(dst, width);
+    NOAHZK_variable_width_shift_right_primitive(dst->arr, dst == src? dst->arr: src->arr, width, width_src, sign, shamt);
+    dst->width = width;
+    dst->sign = sign;
+    NOAHZK_variable_width_drop_bitcnt(dst);
+    NOAHZK_variable_width_auto_trim(dst);
+}
+
+// constant-time, even in shamt
+// scratch has to be NOAHZK_variable_width_shift_barrel_scratch_size(dst->width, src->width) limbs wide.
+void NOAHZK_variable_width_shift_left_barrel_scratch(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const size_t shamt, NOAHZK_limb_t* const scratch){
+    NOAHZK_variable_width_shift_barrel_primitive(dst->arr, src->arr, dst->width, src->width, src->sign, shamt, 1, scratch);
+    NOAHZK_variable_width_shift_update_sign(dst);
+}
+
+void NOAHZK_variable_width_shift_left_barrel(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const size_t shamt){
+    NOAHZK_variable_width_shift_left_barrel_scratch(dst, src, shamt, NOAHZK_default_workspace_get(NOAHZK_variable_width_shift_barrel_scratch_size(dst->width, src->width)));
+}
+
+// constant-time, even in shamt; logical
+// scratch has to be NOAHZK_variable_width_shift_barrel_scratch_size(dst->width, src->width) limbs wide.
+void NOAHZK_variable_width_shift_right_barrel_scratch(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const size_t shamt, NOAHZK_limb_t* const scratch){
+    NOAHZK_variable_width_shift_barrel_primitive(dst->arr, src->arr, dst->width, src->width, 0, shamt, 0, scratch);
+    NOAHZK_variable_width_shift_update_sign(dst);
+}
+
+void NOAHZK_variable_width_shift_right_barrel(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const size_t shamt){
+    NOAHZK_variable_width_shift_right_barrel_scratch(dst, src, shamt, NOAHZK_default_workspace_get(NOAHZK_variable_width_shift_barrel_scratch_size(dst->width, src->width)));
+}
+
+// constant-time, even in shamt
+// scratch has to be NOAHZK_variable_width_shift_barrel_scratch_size(dst->width, src->width) limbs wide.
+void NOAHZK_variable_width_shift_right_arithmetic_barrel_scratch(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const size_t shamt, NOAHZK_limb_t* const scratch){
+    NOAHZK_variable_width_shift_barrel_primitive(dst->arr, src->arr, dst->width, src->width, src->sign, shamt, 0, scratch);
+    NOAHZK_variable_width_shift_update_sign(dst);
+}
+
+void NOAHZK_variable_width_shift_right_arithmetic_barrel(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const size_t shamt){
+    NOAHZK_variable_width_shift_right_arithmetic_barrel_scratch(dst, src, shamt, NOAHZK_default_workspace_get(NOAHZK_variable_width_shift_barrel_scratch_size(dst->width, src->width)));
+}
+
+#endif
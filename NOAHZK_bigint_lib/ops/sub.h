@@ -10,6 +10,7 @@
 #define NOAHZK_bigint_sub_included
 
 #include "definitions.h"    // NOAHZK variable-width type
+#include "cpu.h"            // add_n & sub_n kernels picked for this cpu
 #include "stdint.h"         // integer types
 
 // BE WARY OF HOW C CONVERTS BETWEEN UNSIGNED TYPES!
@@ -61,9 +62,10 @@ void NOAHZK_variable_width_add_or_sub_constant(NOAHZK_variable_width_t* const ds
 }
 
 NOAHZK_limb_t NOAHZK_variable_width_sub_primitive(NOAHZK_limb_t* const dst, const NOAHZK_limb_t* const rs0, const NOAHZK_limb_t* const rs1, const size_t width_dst, const size_t width0, const size_t width1, const NOAHZK_limb_t sign0, const NOAHZK_limb_t sign1){
-    NOAHZK_limb_t carry = 1;
+    const size_t width_common = NOAHZK_MIN(width_dst, NOAHZK_MIN(width0, width1));
+    NOAHZK_limb_t carry = NOAHZK_kernels.sub_n(dst, rs0, rs1, width_common);
 // TODO: SEE IF WORKS WITH PARENTHESES!
-    for(size_t i = 0; i < width_dst; i++){
+    for(size_t i = width_common; i < width_dst; i++){
         const NOAHZK_expanded_limb_t z = NOAHZK_variable_width_get_arr(rs0, width0, sign0, i) + NOAHZK_variable_width_get_arr_inverted(rs1, width1, sign1, i) + (NOAHZK_expanded_limb_t)carry;
         dst[i] = z & NOAHZK_LIMB_MAX;
         carry = NOAHZK_variable_width_get_out(z);
@@ -97,12 +99,29 @@ void NOAHZK_variable_width_sub_and_resize(NOAHZK_variable_width_t* const dst, co
     NOAHZK_variable_width_resize_to_largest(dst, rs0->width, rs1->width);
     const NOAHZK_limb_t cout = NOAHZK_variable_width_sub_primitive(dst->arr, rs0->arr, rs1->arr, dst->width, rs0->width, rs1->width, rs0->sign, rs1->sign);
     NOAHZK_variable_width_handle_carry(dst, rs0->sign, rs1->sign ^ 1, cout);
+    NOAHZK_variable_width_auto_trim(dst);
+}
+
+// not constant-time; for public operands only.
+// dst = rs0 - rs1, sized like NOAHZK_variable_width_add_and_resize_vartime. dst may alias either.
+void NOAHZK_variable_width_sub_and_resize_vartime(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const NOAHZK_variable_width_t* const rs1){
+    const size_t width0 = NOAHZK_variable_width_significant_width_vartime(rs0->arr, rs0->width, rs0->sign);
+    const size_t width1 = NOAHZK_variable_width_significant_width_vartime(rs1->arr, rs1->width, rs1->sign);
+    const size_t width = NOAHZK_MAX(width0, width1) + 1;
+    const NOAHZK_limb_t sign0 = rs0->sign, sign1 = rs1->sign;
+
+    NOAHZK_variable_width_grow(dst, width);
+    NOAHZK_variable_width_sub_primitive(dst->arr, rs0->arr, rs1->arr, width, width0, width1, sign0, sign1);
+    dst->width = width;
+    NOAHZK_variable_width_update_sign(dst);
+    NOAHZK_variable_width_normalize_vartime(dst);
 }
 
 void NOAHZK_variable_width_sub_and_resize_constant(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const rs0, const uint64_t k){
     NOAHZK_variable_width_resize_to_largest(dst, rs0->width, sizeof(k)/sizeof(NOAHZK_limb_t));
     const NOAHZK_limb_t cout = NOAHZK_variable_width_sub_constant_primitive(dst->arr, rs0->arr, k, dst->width, rs0->width, rs0->sign);
     NOAHZK_variable_width_handle_carry(dst, rs0->sign, 1, cout);        // constants that are subtracted are ALWAYS negative
+    NOAHZK_variable_width_auto_trim(dst);
 }
 
 #endif
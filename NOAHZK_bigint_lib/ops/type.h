@@ -13,77 +13,96 @@
 #include "logarithms.h"     // bit and byte width of integer values and arrays
 #include "stdint.h"         // integer types
 #include "string.h"         // memset, memcpy
-#include "stdlib.h"         // dynamic memory operations
+#include "alloc.h"          // NOAHZK_malloc, NOAHZK_free
+
+// gives toinit, which has nothing allocated yet, room for width limbs (left uninitialised): the ones inside it if they're enough
+// (see NOAHZK_INLINE_LIMBS), the heap otherwise.
+void NOAHZK_variable_width_alloc(NOAHZK_variable_width_t* const toinit, const size_t width){
+    toinit->arr = NULL;
+    toinit->capacity = 0;
+    NOAHZK_variable_width_set_capacity(toinit, width);
+}
 
 void* NOAHZK_variable_width_init(NOAHZK_variable_width_t* toinit, const uint64_t width_in_bytes){
-    if(!toinit) toinit = malloc(sizeof(NOAHZK_variable_width_t));
+    if(!toinit) toinit = NOAHZK_malloc(sizeof(NOAHZK_variable_width_t));
 
     const uint64_t width = NOAHZK_SIZE_AS_ARR_OF_TYPE(width_in_bytes, sizeof(NOAHZK_limb_t));
     if(width){
-        toinit->arr = calloc(1, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+        NOAHZK_variable_width_alloc(toinit, width);
+        memset(toinit->arr, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
         toinit->width = width;
     }
     else{
         toinit->arr = NULL;
         toinit->width = 0;
+        toinit->capacity = 0;
     }
     toinit->sign = 0;
+    NOAHZK_variable_width_drop_bitcnt(toinit);
     return toinit;
 }
 
 // initializes toinit to array "arr" of width (in bytes) "width_in_bytes", or returns ptr to NOAHZK_variable_width_t that holds array holding the same contents of arr
 void* NOAHZK_variable_width_init_arr(NOAHZK_variable_width_t* toinit, const void* const arr, const uint64_t width_in_bytes){
-    if(!toinit) toinit = malloc(sizeof(NOAHZK_variable_width_t));
+    if(!toinit) toinit = NOAHZK_malloc(sizeof(NOAHZK_variable_width_t));
 
     const uint64_t width = NOAHZK_SIZE_AS_ARR_OF_TYPE(width_in_bytes, sizeof(NOAHZK_limb_t));
     if(width){
-        toinit->arr = calloc(1, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+        NOAHZK_variable_width_alloc(toinit, width);
+        memset(toinit->arr, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
         memcpy(toinit->arr, arr, width_in_bytes);
         toinit->width = width;
     }
     else{
         toinit->arr = NULL;
         toinit->width = 0;
+        toinit->capacity = 0;
     }
     toinit->sign = 0;
+    NOAHZK_variable_width_drop_bitcnt(toinit);
     return toinit;
 }
 
 // initializes toinit to k, or returns ptr to NOAHZK_variable_width_t that holds k
 void* NOAHZK_variable_width_init_and_resize_unsigned_constant(NOAHZK_variable_width_t* toinit, const uint64_t k){
-    if(!toinit) toinit = malloc(sizeof(NOAHZK_variable_width_t));
+    if(!toinit) toinit = NOAHZK_malloc(sizeof(NOAHZK_variable_width_t));
 
     const uint64_t width_in_bits = NOAHZK_min_bitcnt_var(k);
     const uint64_t width = NOAHZK_SIZE_AS_ARR_OF_TYPE(width_in_bits, BITS_IN_NOAHZK_LIMB);
     if(width){
-        toinit->arr = malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+        NOAHZK_variable_width_alloc(toinit, width);
         memcpy(toinit->arr, &k, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
         toinit->width = width;
     }
     else{
         toinit->arr = NULL;
         toinit->width = 0;
+        toinit->capacity = 0;
     }
     toinit->sign = 0;
+    NOAHZK_variable_width_drop_bitcnt(toinit);
     return toinit;
 }
 
 // initializes toinit to k, or returns ptr to NOAHZK_variable_width_t that holds k
 void* NOAHZK_variable_width_init_and_resize_signed_constant(NOAHZK_variable_width_t* toinit, const int64_t k){
-    if(!toinit) toinit = malloc(sizeof(NOAHZK_variable_width_t));
+    if(!toinit) toinit = NOAHZK_malloc(sizeof(NOAHZK_variable_width_t));
 
     const uint64_t width_in_bits = NOAHZK_min_bitcnt_var(k);
     const uint64_t width = NOAHZK_SIZE_AS_ARR_OF_TYPE(width_in_bits, BITS_IN_NOAHZK_LIMB);
     if(width){
-        toinit->arr = malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+        NOAHZK_variable_width_alloc(toinit, width);
         memcpy(toinit->arr, &k, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
         toinit->width = width;
         toinit->sign = k < 0;
+        NOAHZK_variable_width_drop_bitcnt(toinit);
     }
     else{
         toinit->arr = NULL;
         toinit->width = 0;
+        toinit->capacity = 0;
         toinit->sign = 0;
+        NOAHZK_variable_width_drop_bitcnt(toinit);
     }
     return toinit;
 }
@@ -91,28 +110,31 @@ void* NOAHZK_variable_width_init_and_resize_signed_constant(NOAHZK_variable_widt
 // initializes toinit to k, or returns ptr to NOAHZK_variable_width_t that holds k
 // does so in constant time in regardless of k by allocating a constant number of bytes for it
 void* NOAHZK_variable_width_init_constant(NOAHZK_variable_width_t* toinit, const uint64_t k){
-    if(!toinit) toinit = malloc(sizeof(NOAHZK_variable_width_t));
+    if(!toinit) toinit = NOAHZK_malloc(sizeof(NOAHZK_variable_width_t));
 
     const uint64_t width = NOAHZK_SIZE_AS_ARR_OF_TYPE(sizeof(k), sizeof(NOAHZK_limb_t));
     if(width){
-        toinit->arr = malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+        NOAHZK_variable_width_alloc(toinit, width);
         memcpy(toinit->arr, &k, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
         toinit->width = width;
     }
     else{
         toinit->arr = NULL;
         toinit->width = 0;
+        toinit->capacity = 0;
     }
     toinit->sign = 0;
+    NOAHZK_variable_width_drop_bitcnt(toinit);
     return toinit;
 }
 
 void* NOAHZK_variable_width_copy(NOAHZK_variable_width_t* restrict dst, const NOAHZK_variable_width_t* const restrict src){
-    if(!dst) dst = malloc(sizeof(NOAHZK_variable_width_t));
+    if(!dst) dst = NOAHZK_malloc(sizeof(NOAHZK_variable_width_t));
 
     dst->width = src->width;
-    dst->arr = malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(src));
+    NOAHZK_variable_width_alloc(dst, src->width);
     dst->sign = src->sign;
+    NOAHZK_variable_width_drop_bitcnt(dst);
 
     memcpy(dst->arr, src->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(src));
 
@@ -122,18 +144,19 @@ void* NOAHZK_variable_width_copy(NOAHZK_variable_width_t* restrict dst, const NO
 // copies all the properties of src to dst, doesn't set dst to src
 // doesn't initialise dst array, initialises sign to 0.
 void* NOAHZK_variable_width_copy_properties(NOAHZK_variable_width_t* restrict dst, const NOAHZK_variable_width_t* const restrict src){
-    if(!dst) dst = malloc(sizeof(NOAHZK_variable_width_t));
+    if(!dst) dst = NOAHZK_malloc(sizeof(NOAHZK_variable_width_t));
 
     dst->width = src->width;
-    dst->arr = malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(src));
+    NOAHZK_variable_width_alloc(dst, src->width);
     dst->sign = 0;
+    NOAHZK_variable_width_drop_bitcnt(dst);
 
     return dst;
 }
 
 void* NOAHZK_variable_width_copy_to_arr(void* dst, uint64_t width_dst, const NOAHZK_variable_width_t* const src){
     if(!width_dst) width_dst = NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(src);
-    if(!dst) dst = malloc(width_dst);
+    if(!dst) dst = NOAHZK_malloc(width_dst);
 
     memcpy(dst, src->arr, width_dst);
 
@@ -144,11 +167,22 @@ void* NOAHZK_variable_width_copy_to_arr(void* dst, uint64_t width_dst, const NOA
 // the two may not point to the same object.
 // allocates dst if NULL is passed for it. may destroy src.
 void* NOAHZK_variable_width_move(NOAHZK_variable_width_t* restrict dst, NOAHZK_variable_width_t* const restrict src){
-    if(!dst) dst = malloc(sizeof(NOAHZK_variable_width_t));
+    if(!dst) dst = NOAHZK_malloc(sizeof(NOAHZK_variable_width_t));
 
     dst->width = src->width; src->width = 0;
     dst->arr = src->arr; src->arr = NULL;
     dst->sign = src->sign; src->sign = 0;
+    dst->capacity = src->capacity; src->capacity = 0;
+#if NOAHZK_INLINE_LIMBS
+// limbs kept inside src have to be carried over into dst's
+    if(dst->arr == src->inline_limbs){
+        memcpy(dst->inline_limbs, src->inline_limbs, sizeof(src->inline_limbs));
+        memset(src->inline_limbs, 0, sizeof(src->inline_limbs));
+        dst->arr = dst->inline_limbs;
+    }
+#endif
+    NOAHZK_variable_width_drop_bitcnt(dst);
+    NOAHZK_variable_width_drop_bitcnt(src);
 
     return dst;
 }
@@ -157,29 +191,76 @@ typedef enum{ NOAHZK_variable_width_keep_ptr = 0, NOAHZK_variable_width_free_ptr
 
 void NOAHZK_variable_width_destroy(NOAHZK_variable_width_t* const todestroy, const NOAHZK_variable_width_option_t freeptr){
     if(todestroy->arr){
-        memset(todestroy->arr, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_PTR(todestroy));
+        memset(todestroy->arr, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(todestroy->capacity));
         memset(&todestroy->width, 0, sizeof(todestroy->width));
+        if(!NOAHZK_variable_width_is_inline(todestroy)) NOAHZK_free(todestroy->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(todestroy->capacity));
+        todestroy->arr = NULL;
+        todestroy->capacity = 0;
         todestroy->sign = 0;
-        free(todestroy->arr);
+        NOAHZK_variable_width_drop_bitcnt(todestroy);
     } 
 
-    if(freeptr == NOAHZK_variable_width_free_ptr) free(todestroy);
+    if(freeptr == NOAHZK_variable_width_free_ptr) NOAHZK_free(todestroy, sizeof(NOAHZK_variable_width_t));
+}
+
+// initialises toinit to 0, width limbs wide, with its array taken from the temporary allocator.
+// for temporaries that don't outlive the op using them; they may not be resized & have to be destroyed by NOAHZK_variable_width_destroy_temporary.
+// ones that fit in the limbs inside toinit are kept there instead.
+void NOAHZK_variable_width_init_temporary(NOAHZK_variable_width_t* const toinit, const size_t width){
+    toinit->arr = NULL;
+    toinit->capacity = 0;
+    if(width && width <= NOAHZK_INLINE_LIMBS) NOAHZK_variable_width_set_capacity(toinit, width);
+    else if(width){
+        toinit->arr = NOAHZK_temporary_malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+        toinit->capacity = width;
+    }
+    if(toinit->arr) memset(toinit->arr, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    toinit->width = width;
+    toinit->sign = 0;
+    NOAHZK_variable_width_drop_bitcnt(toinit);
+}
+
+void NOAHZK_variable_width_destroy_temporary(NOAHZK_variable_width_t* const todestroy){
+    if(!NOAHZK_variable_width_is_inline(todestroy)) NOAHZK_temporary_free(todestroy->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(todestroy->capacity));
+    todestroy->arr = NULL;
+    todestroy->width = 0;
+    todestroy->capacity = 0;
+    todestroy->sign = 0;
+    NOAHZK_variable_width_drop_bitcnt(todestroy);
+}
+
+// makes sure var can grow to width limbs without reallocating. never shrinks it & doesn't change var->width.
+void NOAHZK_variable_width_reserve(NOAHZK_variable_width_t* const var, const size_t width){
+    if(var->capacity < width) NOAHZK_variable_width_set_capacity(var, width);
+}
+
+// frees whatever var has allocated past its width, moving its limbs back inside it if they fit there.
+// the freed limbs are cleared first, like in NOAHZK_variable_width_destroy. vars already kept inside have nothing to free.
+void NOAHZK_variable_width_shrink_to_fit(NOAHZK_variable_width_t* const var){
+    if(var->capacity == var->width || NOAHZK_variable_width_is_inline(var)) return;
+
+    memset(var->arr + var->width, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(var->capacity - var->width));
+    if(var->width) NOAHZK_variable_width_set_capacity(var, var->width);
+    else{
+        NOAHZK_free(var->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(var->capacity));
+        var->arr = NULL;
+        var->capacity = 0;
+    }
 }
 
-// not constant-time
-// checks if array is 0
+// checks if array is 0. every limb is read whatever the values, so it's constant-time as long as width is
 int NOAHZK_variable_width_is0(const NOAHZK_limb_t* const src, const size_t width){
-    if(!width) return 1;
-    if(!src[0] && !memcmp(src, src+1, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width-1))) return 1;
-    return 0;
+    NOAHZK_limb_t bits = 0;
+    for(size_t i = 0; i < width; i++) bits |= src[i];
+    return (int)((NOAHZK_limb_t)(bits | -bits) >> (BITS_IN_NOAHZK_LIMB - 1) ^ 1);
 }
 
-// not constant-time
-// checks if array is 1
+// checks if array is 1; constant-time as long as width is
 int NOAHZK_variable_width_is1(const NOAHZK_limb_t* const src, const size_t width){
     if(!width) return 0;
-    if(src[0] == 1 && NOAHZK_variable_width_is0(src+1, width-1)) return 1;
-    return 0;
+    NOAHZK_limb_t bits = src[0] ^ 1;
+    for(size_t i = 1; i < width; i++) bits |= src[i];
+    return (int)((NOAHZK_limb_t)(bits | -bits) >> (BITS_IN_NOAHZK_LIMB - 1) ^ 1);
 }
 
 #endif
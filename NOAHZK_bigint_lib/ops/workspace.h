@@ -0,0 +1,61 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+#ifndef NOAHZK_bigint_workspace_included
+#define NOAHZK_bigint_workspace_included
+
+#include "definitions.h"    // NOAHZK_limb_t
+#include "alloc.h"          // NOAHZK_malloc, NOAHZK_THREAD_LOCAL
+#include "string.h"         // memset
+
+// scratch memory for the multiplication & shift kernels.
+// every kernel has a _scratch variant that takes a caller-supplied buffer of at least <op>_scratch_size(...) limbs & never allocates;
+// the variants without the suffix take their scratch from a default workspace, which is thread-local & only grows.
+// none of the functions using the default workspace call one another, so it's never handed out twice at once.
+
+typedef struct{
+    NOAHZK_limb_t* arr;
+    size_t capacity;                // in limbs
+} NOAHZK_workspace_t;
+
+#define NOAHZK_workspace_INITIALISER {NULL, 0}
+
+// clears & frees whatever ws holds; it can be used again afterwards.
+void NOAHZK_workspace_destroy(NOAHZK_workspace_t* const ws){
+    if(ws->arr){
+        memset(ws->arr, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(ws->capacity));
+        NOAHZK_free(ws->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(ws->capacity));
+    }
+    ws->arr = NULL;
+    ws->capacity = 0;
+}
+
+// returns a buffer of at least width limbs from ws, growing it geometrically if it's too small.
+// its contents are unspecified; they aren't kept when it grows.
+NOAHZK_limb_t* NOAHZK_workspace_get(NOAHZK_workspace_t* const ws, const size_t width){
+    if(ws->capacity < width){
+        const size_t new_capacity = NOAHZK_MAX(width, 2*ws->capacity);
+        NOAHZK_workspace_destroy(ws);
+        ws->arr = NOAHZK_malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(new_capacity));
+        ws->capacity = new_capacity;
+    }
+    return ws->arr;
+}
+
+NOAHZK_THREAD_LOCAL NOAHZK_workspace_t NOAHZK_default_workspace = NOAHZK_workspace_INITIALISER;
+
+NOAHZK_limb_t* NOAHZK_default_workspace_get(const size_t width){
+    return NOAHZK_workspace_get(&NOAHZK_default_workspace, width);
+}
+
+// frees the calling thread's default workspace; call it before the thread exits.
+void NOAHZK_default_workspace_release(void){
+    NOAHZK_workspace_destroy(&NOAHZK_default_workspace);
+}
+
+#endif
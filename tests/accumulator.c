@@ -0,0 +1,119 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+// checks NOAHZK_accumulator_t against NOAHZK_variable_width_add_and_resize & _sub_and_resize, which never wrap: runs of adds & subtracts of
+// signed values narrower & wider than the accumulator (the largest positive & negative ones among them, so the sum wraps modulo B^width),
+// normalised into a dst of the accumulator's width, a narrower & a wider one & by _and_resize, once as they come & once with the columns
+// carried before every add, which is what running out of headroom does.
+
+#include "test.h"           // checks & the report
+
+// fixed-seed xorshift, so a failure can be reproduced
+uint64_t NOAHZK_test_state = 0x9e3779b97f4a7c15;
+
+NOAHZK_limb_t NOAHZK_test_random_limb(void){
+    NOAHZK_test_state ^= NOAHZK_test_state << 13;
+    NOAHZK_test_state ^= NOAHZK_test_state >> 7;
+    NOAHZK_test_state ^= NOAHZK_test_state << 17;
+    return (NOAHZK_limb_t)NOAHZK_test_state;
+}
+
+// limb i of var, sign-extended past its width
+NOAHZK_limb_t NOAHZK_test_limb(const NOAHZK_variable_width_t* const var, const size_t i){
+    return i < var->width? var->arr[i]: -(NOAHZK_limb_t)var->sign;
+}
+
+// dst against sum modulo B^width, truncated or sign-extended to dst's width
+void NOAHZK_test_sum(const char* const form, const NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const sum, const size_t width){
+    const NOAHZK_limb_t extension = -(NOAHZK_test_limb(sum, width - 1) >> (BITS_IN_NOAHZK_LIMB - 1));
+    int ok = dst->sign == (dst->width? dst->arr[dst->width - 1] >> (BITS_IN_NOAHZK_LIMB - 1): 0);
+    for(size_t i = 0; i < dst->width; i++) ok &= dst->arr[i] == (i < width? NOAHZK_test_limb(sum, i): extension);
+    NOAHZK_test_expect(ok, "accumulator", form);
+}
+
+// acc against the sum so far, normalised every way there is
+void NOAHZK_test_normalize(const NOAHZK_accumulator_t* const acc, const NOAHZK_variable_width_t* const sum, const char* const carried){
+    const size_t width = acc->width, widths[] = {width, width + 2, width - 1};
+    NOAHZK_variable_width_t dst = NOAHZK_variable_width_INITIALISER;
+    char form[64];
+
+    for(size_t i = 0; i < sizeof(widths)/sizeof(widths[0]) - (width == 1); i++){
+        NOAHZK_test_init(&dst, widths[i]);
+        NOAHZK_accumulator_normalize(&dst, acc);
+        snprintf(form, sizeof(form), "%zu limbs into %zu%s", width, widths[i], carried);
+        NOAHZK_test_sum(form, &dst, sum, width);
+        NOAHZK_variable_width_destroy(&dst, NOAHZK_variable_width_keep_ptr);
+    }
+
+// trimmed, so it's compared sign-extended back to the accumulator's width
+    NOAHZK_accumulator_normalize_and_resize(&dst, acc);
+    snprintf(form, sizeof(form), "%zu limbs and resized%s", width, carried);
+    int ok = dst.width && dst.width <= width;
+    for(size_t i = 0; ok && i < width; i++) ok &= NOAHZK_test_limb(&dst, i) == NOAHZK_test_limb(sum, i);
+    NOAHZK_test_expect(ok, "accumulator", form);
+    NOAHZK_variable_width_destroy(&dst, NOAHZK_variable_width_keep_ptr);
+}
+
+void NOAHZK_test_accumulator(const size_t width, const int carry){
+    const char* const carried = carry? ", carried before every add": "";
+    NOAHZK_accumulator_t acc;
+    NOAHZK_accumulator_init(&acc, width);
+    NOAHZK_variable_width_t src = NOAHZK_variable_width_INITIALISER, sum = NOAHZK_variable_width_INITIALISER, next = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_test_init(&sum, 1);
+
+    for(size_t step = 0; step < 300; step++){
+// 0 to 2 limbs wider than acc; every 7th is the largest positive value of its width & every 11th the largest negative one
+        const size_t width_src = NOAHZK_test_random_limb() % (width + 3);
+        NOAHZK_test_init(&src, width_src);
+        for(size_t i = 0; i < width_src; i++) src.arr[i] = NOAHZK_test_random_limb();
+        if(width_src && step%7 == 6){
+            memset(src.arr, 0xff, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_src));
+            src.arr[width_src - 1] >>= 1;
+        }
+        if(width_src && step%11 == 10){
+            memset(src.arr, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width_src));
+            src.arr[width_src - 1] = (NOAHZK_limb_t)1 << (BITS_IN_NOAHZK_LIMB - 1);
+        }
+        if(width_src) NOAHZK_variable_width_update_sign(&src);
+
+        if(carry) acc.headroom = 0;
+        if(NOAHZK_test_random_limb() & 1){
+            NOAHZK_accumulator_sub(&acc, &src);
+            NOAHZK_variable_width_sub_and_resize(&next, &sum, &src);
+        }
+        else{
+            NOAHZK_accumulator_add(&acc, &src);
+            NOAHZK_variable_width_add_and_resize(&next, &sum, &src);
+        }
+        NOAHZK_variable_width_destroy(&sum, NOAHZK_variable_width_keep_ptr);
+        NOAHZK_variable_width_move(&sum, &next);
+        NOAHZK_variable_width_destroy(&src, NOAHZK_variable_width_keep_ptr);
+
+        if(step%20 == 19) NOAHZK_test_normalize(&acc, &sum, carried);
+    }
+
+// cleared, it's 0 again
+    NOAHZK_accumulator_clear(&acc);
+    NOAHZK_variable_width_destroy(&sum, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_test_init(&sum, 1);
+    NOAHZK_test_normalize(&acc, &sum, carried);
+
+    NOAHZK_variable_width_destroy(&sum, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&next, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_accumulator_destroy(&acc, NOAHZK_variable_width_keep_ptr);
+}
+
+int main(void){
+    const size_t widths[] = {1, 2, 3, 8, 33};
+    for(size_t i = 0; i < sizeof(widths)/sizeof(widths[0]); i++){
+        NOAHZK_test_accumulator(widths[i], 0);
+        NOAHZK_test_accumulator(widths[i], 1);
+    }
+
+    return NOAHZK_test_report("accumulator");
+}
@@ -0,0 +1,145 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+// checks Barrett reduction (both forms, & with dst aliasing src) against NOAHZK_variable_width_divrem_and_resize: moduli of one limb & of k limbs (with their top limbs small,
+// all ones & random), inputs of every width up to 2k limbs, & inputs at & just below multiples of N, where the quotient estimate is
+// most likely to come up short & the two correcting subtractions both have to happen.
+
+#include "test.h"           // checks & the report
+
+// fixed-seed xorshift, so a failure can be reproduced
+uint64_t NOAHZK_test_state = 0x9e3779b97f4a7c15;
+
+NOAHZK_limb_t NOAHZK_test_random_limb(void){
+    NOAHZK_test_state ^= NOAHZK_test_state << 13;
+    NOAHZK_test_state ^= NOAHZK_test_state >> 7;
+    NOAHZK_test_state ^= NOAHZK_test_state << 17;
+    return (NOAHZK_limb_t)NOAHZK_test_state;
+}
+
+// var = an unsigned value of width random limbs, with a 0 limb on top so it stays nonnegative; top replaces the topmost random limb
+void NOAHZK_test_random(NOAHZK_variable_width_t* const var, const size_t width, const NOAHZK_limb_t top){
+    NOAHZK_test_init(var, width + 1);
+    for(size_t i = 0; i < width; i++) var->arr[i] = NOAHZK_test_random_limb();
+    if(width) var->arr[width - 1] = top;
+    NOAHZK_variable_width_update_sign(var);
+}
+
+// src mod N by both Barrett forms, each against the remainder from divrem_and_resize
+void NOAHZK_test_reduce(const NOAHZK_variable_width_t* const src, const NOAHZK_variable_width_t* const modulus, const NOAHZK_barrett_ctx_t* const ctx, const char* const form){
+    NOAHZK_variable_width_t q = NOAHZK_variable_width_INITIALISER, r = NOAHZK_variable_width_INITIALISER, dst = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_variable_width_divrem_and_resize(&q, &r, src, modulus);
+    const size_t size = NOAHZK_variable_width_to_hex_size(&r);
+    char* const expected = malloc(size);
+    NOAHZK_variable_width_to_hex(expected, size, &r);
+
+// a limb wider than it has to be, so clearing the limbs above k gets checked too
+    NOAHZK_test_init(&dst, ctx->width + 1);
+    memset(dst.arr, 0xff, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(dst.width));
+    NOAHZK_variable_width_barrett_reduce(&dst, src, ctx);
+    NOAHZK_test_check("barrett", form, &dst, expected);
+
+    NOAHZK_limb_t* const scratch = malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(NOAHZK_variable_width_barrett_reduce_scratch_size(ctx)));
+    memset(dst.arr, 0xff, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(dst.width));
+    NOAHZK_variable_width_barrett_reduce_scratch(&dst, src, ctx, scratch);
+    NOAHZK_test_check("barrett", form, &dst, expected);
+    free(scratch);
+
+// dst aliasing src, which has to be at least k limbs for it
+    NOAHZK_variable_width_destroy(&dst, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_test_init(&dst, NOAHZK_MAX(src->width, ctx->width));
+    memset(dst.arr, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(dst.width));
+    memcpy(dst.arr, src->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(src->width));
+    NOAHZK_variable_width_barrett_reduce(&dst, &dst, ctx);
+    NOAHZK_test_check("barrett", form, &dst, expected);
+
+    NOAHZK_variable_width_destroy(&q, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&dst, NOAHZK_variable_width_keep_ptr);
+    free(expected);
+}
+
+// m*N + offset, for offset of -1 or 0
+void NOAHZK_test_reduce_multiple(const NOAHZK_variable_width_t* const modulus, const NOAHZK_barrett_ctx_t* const ctx, const NOAHZK_variable_width_t* const m, const int offset){
+    NOAHZK_variable_width_t src = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_variable_width_mul_and_resize(&src, modulus, m);
+    if(offset) NOAHZK_variable_width_sub_and_resize_constant(&src, &src, 1);
+    NOAHZK_test_reduce(&src, modulus, ctx, offset? "m*N - 1": "m*N");
+    NOAHZK_variable_width_destroy(&src, NOAHZK_variable_width_keep_ptr);
+}
+
+void NOAHZK_test_barrett(const NOAHZK_variable_width_t* const modulus){
+    NOAHZK_barrett_ctx_t ctx;
+    if(!NOAHZK_test_expect(NOAHZK_barrett_ctx_init(&ctx, modulus) != NULL, "barrett", "context for the modulus")) return;
+    const size_t k = ctx.width;
+    NOAHZK_variable_width_t src = NOAHZK_variable_width_INITIALISER, m = NOAHZK_variable_width_INITIALISER, r = NOAHZK_variable_width_INITIALISER;
+
+// every width up to 2k limbs, random & all ones
+    for(size_t width = 0; width <= 2*k; width++){
+        NOAHZK_test_random(&src, width, NOAHZK_test_random_limb());
+        NOAHZK_test_reduce(&src, modulus, &ctx, "random");
+        if(width) memset(src.arr, 0xff, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+        NOAHZK_test_reduce(&src, modulus, &ctx, "all ones");
+        NOAHZK_variable_width_destroy(&src, NOAHZK_variable_width_keep_ptr);
+    }
+
+// at & just below m*N for small m, random m, & the largest m with m*N below B^2k
+    for(NOAHZK_limb_t small = 1; small <= 4; small++){
+        NOAHZK_test_init(&m, 1);
+        m.arr[0] = small;
+        NOAHZK_test_reduce_multiple(modulus, &ctx, &m, -1);
+        NOAHZK_test_reduce_multiple(modulus, &ctx, &m, 0);
+        NOAHZK_variable_width_destroy(&m, NOAHZK_variable_width_keep_ptr);
+    }
+    for(size_t i = 0; i < 8; i++){
+        NOAHZK_test_random(&m, k, NOAHZK_test_random_limb() >> (i%BITS_IN_NOAHZK_LIMB));
+        NOAHZK_test_reduce_multiple(modulus, &ctx, &m, -1);
+        NOAHZK_test_reduce_multiple(modulus, &ctx, &m, 0);
+        NOAHZK_variable_width_destroy(&m, NOAHZK_variable_width_keep_ptr);
+    }
+
+    NOAHZK_test_random(&src, 2*k, 0);
+    memset(src.arr, 0xff, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(2*k));
+    NOAHZK_variable_width_divrem_and_resize(&m, &r, &src, modulus);
+    NOAHZK_test_reduce_multiple(modulus, &ctx, &m, -1);
+    NOAHZK_test_reduce_multiple(modulus, &ctx, &m, 0);
+
+    NOAHZK_variable_width_destroy(&src, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&m, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_barrett_ctx_destroy(&ctx, NOAHZK_variable_width_keep_ptr);
+}
+
+int main(void){
+    NOAHZK_variable_width_t modulus = NOAHZK_variable_width_INITIALISER;
+
+// one limb: 1, 3, the smallest with its top bit set, all ones & random
+    const NOAHZK_limb_t limbs[] = {1, 3, (NOAHZK_limb_t)1 << (BITS_IN_NOAHZK_LIMB - 1), NOAHZK_LIMB_MAX, NOAHZK_test_random_limb(), NOAHZK_test_random_limb() >> 7};
+    for(size_t i = 0; i < sizeof(limbs)/sizeof(limbs[0]); i++){
+        NOAHZK_test_random(&modulus, 1, limbs[i]);
+        NOAHZK_test_barrett(&modulus);
+        NOAHZK_variable_width_destroy(&modulus, NOAHZK_variable_width_keep_ptr);
+    }
+
+// k limbs, including widths past the Karatsuba threshold, with a top limb of 1, all ones & random, & B^(k-1) itself
+    const size_t widths[] = {2, 3, 5, 17, 33, 70};
+    for(size_t i = 0; i < sizeof(widths)/sizeof(widths[0]); i++){
+        const NOAHZK_limb_t tops[] = {1, NOAHZK_LIMB_MAX, NOAHZK_test_random_limb()};
+        for(size_t t = 0; t < sizeof(tops)/sizeof(tops[0]); t++){
+            NOAHZK_test_random(&modulus, widths[i], tops[t]);
+            NOAHZK_test_barrett(&modulus);
+            NOAHZK_variable_width_destroy(&modulus, NOAHZK_variable_width_keep_ptr);
+        }
+        NOAHZK_test_random(&modulus, widths[i], 1);
+        memset(modulus.arr, 0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(widths[i] - 1));
+        NOAHZK_test_barrett(&modulus);
+        NOAHZK_variable_width_destroy(&modulus, NOAHZK_variable_width_keep_ptr);
+    }
+
+    return NOAHZK_test_report("barrett");
+}
@@ -0,0 +1,137 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+// checks NOAHZK_batch_add, _sub & _mul against the _portable kernels, & every element of those against the one-at-a-time ops,
+// which wrap at the element's width like the batches do. the plain builds only ever pick the portable kernels; the Makefile also builds
+// this with -mavx2, -mavx512f & -mavx512ifma (& 32-bit limbs, which the vector kernels need), & those are skipped on cpus without them.
+// counts that aren't multiples of NOAHZK_BATCH_LANES leave padding lanes, & widths above NOAHZK_BATCH_IFMA_MAX_WIDTH go past the IFMA kernel.
+
+#include "test.h"           // checks & the report
+
+// fixed-seed xorshift, so a failure can be reproduced
+uint64_t NOAHZK_test_state = 0x9e3779b97f4a7c15;
+
+NOAHZK_limb_t NOAHZK_test_random_limb(void){
+    NOAHZK_test_state ^= NOAHZK_test_state << 13;
+    NOAHZK_test_state ^= NOAHZK_test_state >> 7;
+    NOAHZK_test_state ^= NOAHZK_test_state << 17;
+    return (NOAHZK_limb_t)NOAHZK_test_state;
+}
+
+// the kernels NOAHZK_batch_add & co. pick in this build, & whether this cpu can run them
+const char* NOAHZK_test_kernels(int* const supported){
+#if defined(NOAHZK_BATCH_IFMA)
+    *supported = __builtin_cpu_supports("avx512ifma");
+    return "avx512ifma";
+#elif defined(NOAHZK_BATCH_AVX512)
+    *supported = __builtin_cpu_supports("avx512f");
+    return "avx512f";
+#elif defined(NOAHZK_BATCH_AVX2)
+    *supported = __builtin_cpu_supports("avx2");
+    return "avx2";
+#else
+    *supported = 1;
+    return "portable";
+#endif
+}
+
+// every third element is all ones, whose products have the largest column sums; the rest are random
+void NOAHZK_test_fill(NOAHZK_batch_t* const batch){
+    for(size_t j = 0; j < batch->count; j++)
+        for(size_t i = 0; i < batch->width; i++) batch->arr[i*batch->stride + j] = j%3 == 2? NOAHZK_LIMB_MAX: NOAHZK_test_random_limb();
+}
+
+// elements of dst against op applied to the elements of rs0 & rs1 one at a time, at the batches' width
+void NOAHZK_test_elements(const char* const op, const char* const form, const NOAHZK_batch_t* const dst, const NOAHZK_batch_t* const rs0, const NOAHZK_batch_t* const rs1){
+    NOAHZK_variable_width_t a = NOAHZK_variable_width_INITIALISER, b = NOAHZK_variable_width_INITIALISER, r = NOAHZK_variable_width_INITIALISER, expected = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_test_init(&a, dst->width);
+    NOAHZK_test_init(&b, dst->width);
+    NOAHZK_test_init(&r, dst->width);
+    NOAHZK_test_init(&expected, dst->width);
+
+    int ok = 1;
+    for(size_t j = 0; j < dst->count; j++){
+        NOAHZK_batch_get(&a, rs0, j);
+        NOAHZK_batch_get(&b, rs1, j);
+        NOAHZK_batch_get(&r, dst, j);
+        if(op[0] == 'a') NOAHZK_variable_width_add(&expected, &a, &b);
+        else if(op[0] == 's') NOAHZK_variable_width_sub(&expected, &a, &b);
+        else NOAHZK_variable_width_mul(&expected, &a, &b);
+        ok &= !memcmp(r.arr, expected.arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(dst->width));
+    }
+    NOAHZK_test_expect(ok, op, form);
+
+    NOAHZK_variable_width_destroy(&a, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&b, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&expected, NOAHZK_variable_width_keep_ptr);
+}
+
+void NOAHZK_test_batch(const size_t count, const size_t width){
+    NOAHZK_batch_t rs0, rs1, dst, portable;
+    NOAHZK_batch_init(&rs0, count, width);
+    NOAHZK_batch_init(&rs1, count, width);
+    NOAHZK_batch_init(&dst, count, width);
+    NOAHZK_batch_init(&portable, count, width);
+    NOAHZK_test_fill(&rs0);
+    NOAHZK_test_fill(&rs1);
+    const size_t size = NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(dst.stride*width);
+    char form[64];
+    snprintf(form, sizeof(form), "%zu elements of %zu limbs", count, width);
+
+// the padding lanes are compared as well; they have to stay whatever the kernels make of zeros
+    NOAHZK_batch_add(&dst, &rs0, &rs1);
+    NOAHZK_batch_add_portable(portable.arr, rs0.arr, rs1.arr, width, portable.stride);
+    NOAHZK_test_expect(!memcmp(dst.arr, portable.arr, size), "add", form);
+    NOAHZK_test_elements("add", form, &portable, &rs0, &rs1);
+
+    NOAHZK_batch_sub(&dst, &rs0, &rs1);
+    NOAHZK_batch_sub_portable(portable.arr, rs0.arr, rs1.arr, width, portable.stride);
+    NOAHZK_test_expect(!memcmp(dst.arr, portable.arr, size), "sub", form);
+    NOAHZK_test_elements("sub", form, &portable, &rs0, &rs1);
+
+    NOAHZK_batch_mul(&dst, &rs0, &rs1);
+    NOAHZK_batch_mul_portable(portable.arr, rs0.arr, rs1.arr, width, portable.stride);
+    NOAHZK_test_expect(!memcmp(dst.arr, portable.arr, size), "mul", form);
+    NOAHZK_test_elements("mul", form, &portable, &rs0, &rs1);
+
+// dst aliasing a source, which add & sub allow
+    NOAHZK_batch_add_portable(portable.arr, rs0.arr, rs1.arr, width, portable.stride);
+    NOAHZK_batch_add(&rs0, &rs0, &rs1);
+    NOAHZK_test_expect(!memcmp(rs0.arr, portable.arr, size), "add in place", form);
+    NOAHZK_batch_sub_portable(portable.arr, rs0.arr, rs1.arr, width, portable.stride);
+    NOAHZK_batch_sub(&rs0, &rs0, &rs1);
+    NOAHZK_test_expect(!memcmp(rs0.arr, portable.arr, size), "sub in place", form);
+
+    NOAHZK_batch_destroy(&rs0, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_batch_destroy(&rs1, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_batch_destroy(&dst, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_batch_destroy(&portable, NOAHZK_variable_width_keep_ptr);
+}
+
+int main(void){
+    int supported;
+    const char* const kernels = NOAHZK_test_kernels(&supported);
+    if(!supported){
+        printf("batch (%s), %zu-bit limbs: skipped, this cpu can't run them\n", kernels, (size_t)BITS_IN_NOAHZK_LIMB);
+        return 0;
+    }
+
+    const size_t counts[] = {1, 15, 16, 17, 33, 100}, widths[] = {1, 2, 3, 8, 31, 64};
+    for(size_t c = 0; c < sizeof(counts)/sizeof(counts[0]); c++)
+        for(size_t w = 0; w < sizeof(widths)/sizeof(widths[0]); w++) NOAHZK_test_batch(counts[c], widths[w]);
+
+// either side of the IFMA kernel's limit
+    NOAHZK_test_batch(17, NOAHZK_BATCH_IFMA_MAX_WIDTH);
+    NOAHZK_test_batch(17, NOAHZK_BATCH_IFMA_MAX_WIDTH + 1);
+    NOAHZK_test_batch(5, NOAHZK_BATCH_IFMA_MAX_WIDTH + 37);
+
+    char name[32];
+    snprintf(name, sizeof(name), "batch (%s)", kernels);
+    return NOAHZK_test_report(name);
+}
@@ -0,0 +1,260 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+// checks containers: fixed-stride & indexed ones written, opened (from the file & from memory) & read back by both NOAHZK_container_view &
+// NOAHZK_container_load_and_resize; every truncation of them & corrupted headers, which NOAHZK_container_open_memory has to refuse;
+// corrupted records, which it accepts but viewing & loading refuse; & containers built by hand with either limb size & byte order,
+// which always load, but only view when the cpu could use their limbs in place.
+
+#include "test.h"           // checks & the report
+
+// fixed-seed xorshift, so a failure can be reproduced
+uint64_t NOAHZK_test_state = 0x9e3779b97f4a7c15;
+
+NOAHZK_limb_t NOAHZK_test_random_limb(void){
+    NOAHZK_test_state ^= NOAHZK_test_state << 13;
+    NOAHZK_test_state ^= NOAHZK_test_state >> 7;
+    NOAHZK_test_state ^= NOAHZK_test_state << 17;
+    return (NOAHZK_limb_t)NOAHZK_test_state;
+}
+
+// count random values, value i being widths[i] limbs wide; about half of them are negative
+NOAHZK_variable_width_t* NOAHZK_test_values(const size_t* const widths, const size_t count){
+    NOAHZK_variable_width_t* const values = malloc(count*sizeof(NOAHZK_variable_width_t));
+    for(size_t i = 0; i < count; i++){
+        NOAHZK_test_init(&values[i], widths[i]);
+        for(size_t j = 0; j < widths[i]; j++) values[i].arr[j] = NOAHZK_test_random_limb();
+        if(widths[i]) NOAHZK_variable_width_update_sign(&values[i]);
+    }
+    return values;
+}
+
+void NOAHZK_test_values_destroy(NOAHZK_variable_width_t* const values, const size_t count){
+    for(size_t i = 0; i < count; i++) NOAHZK_variable_width_destroy(&values[i], NOAHZK_variable_width_keep_ptr);
+    free(values);
+}
+
+// the whole file at path, in memory
+uint8_t* NOAHZK_test_read(const char* const path, size_t* const size){
+    FILE* const file = fopen(path, "rb");
+    fseek(file, 0, SEEK_END);
+    *size = (size_t)ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t* const base = malloc(*size);
+    *size = fread(base, 1, *size, file);
+    fclose(file);
+    return base;
+}
+
+// every record of container against values, viewed (if view is set; it's expected to fail otherwise) & loaded, & nothing past the last one
+void NOAHZK_test_records(const NOAHZK_container_t* const container, const NOAHZK_variable_width_t* const values, const size_t count, const int view, const char* const form){
+    NOAHZK_variable_width_t record = NOAHZK_variable_width_INITIALISER, loaded = NOAHZK_variable_width_INITIALISER;
+    int ok = container->count == count;
+
+    for(size_t i = 0; ok && i < count; i++){
+        if(view) ok &= NOAHZK_container_view(&record, container, i) && NOAHZK_variable_width_eq(&record, &values[i]);
+        else ok &= !NOAHZK_container_view(&record, container, i);
+        ok &= NOAHZK_container_load_and_resize(&loaded, container, i) && NOAHZK_variable_width_eq(&loaded, &values[i]);
+    }
+    ok &= !NOAHZK_container_view(&record, container, count) && !NOAHZK_container_load_and_resize(&loaded, container, count);
+    NOAHZK_test_expect(ok, "container", form);
+
+    NOAHZK_variable_width_destroy(&loaded, NOAHZK_variable_width_keep_ptr);
+}
+
+// field of the header at offset (a u64, or its low byte if byte is set) replaced with x: open_memory has to refuse it
+void NOAHZK_test_corrupt_header(const uint8_t* const base, const size_t size, const size_t offset, const uint64_t x, const int byte, const char* const form){
+    uint8_t* const corrupt = malloc(size);
+    memcpy(corrupt, base, size);
+    if(byte) corrupt[offset] = (uint8_t)x;
+    else NOAHZK_container_put64(corrupt + offset, x);
+
+    NOAHZK_container_t container;
+    NOAHZK_test_expect(!NOAHZK_container_open_memory(&container, corrupt, size), "container", form);
+    free(corrupt);
+}
+
+// u64 at offset replaced with x: open_memory still accepts it, but record i can be neither viewed nor loaded
+void NOAHZK_test_corrupt_record(const uint8_t* const base, const size_t size, const size_t offset, const uint64_t x, const uint64_t i, const char* const form){
+    uint8_t* const corrupt = malloc(size);
+    memcpy(corrupt, base, size);
+    NOAHZK_container_put64(corrupt + offset, x);
+
+    NOAHZK_container_t container;
+    NOAHZK_variable_width_t record = NOAHZK_variable_width_INITIALISER, loaded = NOAHZK_variable_width_INITIALISER;
+    int ok = NOAHZK_container_open_memory(&container, corrupt, size);
+    ok = ok && !NOAHZK_container_view(&record, &container, i) && !NOAHZK_container_load_and_resize(&loaded, &container, i);
+    NOAHZK_test_expect(ok, "container", form);
+    free(corrupt);
+}
+
+// values written with stride (0 for an indexed container), then read back from the file & from memory, then truncated & corrupted
+void NOAHZK_test_round_trip(const size_t* const widths, const size_t count, const size_t stride){
+    NOAHZK_variable_width_t* const values = NOAHZK_test_values(widths, count);
+    const char* const kind = stride? "fixed-stride": "indexed";
+    char path[64], form[96];
+    snprintf(path, sizeof(path), "tests/container_%zu.tmp", (size_t)BITS_IN_NOAHZK_LIMB);
+
+    NOAHZK_container_writer_t writer;
+    int ok = NOAHZK_container_writer_open(&writer, path, stride);
+    for(size_t i = 0; ok && i < count; i++) ok &= NOAHZK_container_append(&writer, &values[i]);
+// a var wider than the stride is refused, & leaves nothing behind
+    if(stride){
+        NOAHZK_variable_width_t wide = NOAHZK_variable_width_INITIALISER;
+        NOAHZK_test_init(&wide, stride + 1);
+        snprintf(form, sizeof(form), "%s, appending one wider than the stride", kind);
+        NOAHZK_test_expect(!NOAHZK_container_append(&writer, &wide), "container", form);
+        NOAHZK_variable_width_destroy(&wide, NOAHZK_variable_width_keep_ptr);
+    }
+    ok &= NOAHZK_container_writer_close(&writer);
+    snprintf(form, sizeof(form), "%s, writing", kind);
+    NOAHZK_test_expect(ok, "container", form);
+
+    NOAHZK_container_t container;
+    snprintf(form, sizeof(form), "%s, from the file", kind);
+    if(NOAHZK_test_expect(NOAHZK_container_open(&container, path), "container", form)){
+        NOAHZK_test_records(&container, values, count, 1, form);
+        NOAHZK_container_close(&container);
+    }
+    size_t size;
+    uint8_t* const base = NOAHZK_test_read(path, &size);
+    remove(path);
+    snprintf(form, sizeof(form), "%s, from memory", kind);
+    if(NOAHZK_test_expect(NOAHZK_container_open_memory(&container, base, size), "container", form)){
+        NOAHZK_test_records(&container, values, count, 1, form);
+        NOAHZK_container_close(&container);
+    }
+
+// the records (& the index, if there is one) end exactly at the end of the file, so every shorter prefix is missing something
+    ok = 1;
+    for(size_t truncated = 0; truncated < size; truncated++) ok &= !NOAHZK_container_open_memory(&container, base, truncated);
+    snprintf(form, sizeof(form), "%s, truncated", kind);
+    NOAHZK_test_expect(ok, "container", form);
+
+    const uint64_t records = NOAHZK_container_get64(base + 32), index = NOAHZK_container_get64(base + 40);
+    snprintf(form, sizeof(form), "%s, magic", kind);
+    NOAHZK_test_corrupt_header(base, size, 0, 'n', 1, form);
+    snprintf(form, sizeof(form), "%s, version", kind);
+    NOAHZK_test_corrupt_header(base, size, 8, NOAHZK_CONTAINER_VERSION + 1, 1, form);
+    snprintf(form, sizeof(form), "%s, limb size", kind);
+    NOAHZK_test_corrupt_header(base, size, 12, 3, 1, form);
+    snprintf(form, sizeof(form), "%s, endianness", kind);
+    NOAHZK_test_corrupt_header(base, size, 13, 0, 1, form);
+    NOAHZK_test_corrupt_header(base, size, 13, 3, 1, form);
+    snprintf(form, sizeof(form), "%s, count", kind);
+    NOAHZK_test_corrupt_header(base, size, 16, count + 1, 0, form);
+    NOAHZK_test_corrupt_header(base, size, 16, UINT64_MAX, 0, form);
+    snprintf(form, sizeof(form), "%s, where the records start", kind);
+    NOAHZK_test_corrupt_header(base, size, 32, NOAHZK_CONTAINER_HEADER_SIZE - 8, 0, form);
+    NOAHZK_test_corrupt_header(base, size, 32, NOAHZK_CONTAINER_HEADER_SIZE + 4, 0, form);
+    NOAHZK_test_corrupt_header(base, size, 32, size + 8, 0, form);
+    NOAHZK_test_corrupt_header(base, size, 32, UINT64_MAX - 7, 0, form);
+    if(stride){
+        snprintf(form, sizeof(form), "%s, stride", kind);
+        NOAHZK_test_corrupt_header(base, size, 24, 2*stride, 0, form);
+        NOAHZK_test_corrupt_header(base, size, 24, UINT64_MAX, 0, form);
+
+// a record claiming to be wider than the stride
+        snprintf(form, sizeof(form), "%s, a record's width", kind);
+        NOAHZK_test_corrupt_record(base, size, records + NOAHZK_CONTAINER_RECORD_SIZE(stride, sizeof(NOAHZK_limb_t)), stride + 1, 1, form);
+    }
+    else{
+        snprintf(form, sizeof(form), "%s, where the index starts", kind);
+        NOAHZK_test_corrupt_header(base, size, 40, records - 8, 0, form);
+        NOAHZK_test_corrupt_header(base, size, 40, size + 8, 0, form);
+        NOAHZK_test_corrupt_header(base, size, 40, UINT64_MAX, 0, form);
+
+// index entries pointing into the header, at the index itself & past the end, & a record running into the index
+        snprintf(form, sizeof(form), "%s, an index entry", kind);
+        NOAHZK_test_corrupt_record(base, size, index + 8, 8, 1, form);
+        NOAHZK_test_corrupt_record(base, size, index + 8, index, 1, form);
+        NOAHZK_test_corrupt_record(base, size, index + 8, UINT64_MAX - 7, 1, form);
+        snprintf(form, sizeof(form), "%s, a record's width", kind);
+        NOAHZK_test_corrupt_record(base, size, NOAHZK_container_get64(base + index + 8*(count - 1)), (index - records)/sizeof(NOAHZK_limb_t), count - 1, form);
+        NOAHZK_test_corrupt_record(base, size, NOAHZK_container_get64(base + index + 8*(count - 1)), UINT64_MAX, count - 1, form);
+    }
+
+    free(base);
+    NOAHZK_test_values_destroy(values, count);
+}
+
+// an indexed container of values, encoded by hand with limbs of limb_size bytes in the given byte order; returns it & its size
+uint8_t* NOAHZK_test_encode(const NOAHZK_variable_width_t* const values, const size_t count, const size_t limb_size, const uint8_t endianness, size_t* const size){
+    size_t records_size = 0;
+    for(size_t i = 0; i < count; i++){
+        const size_t width = NOAHZK_SIZE_AS_ARR_OF_TYPE(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(values[i].width), limb_size);
+        records_size += NOAHZK_CONTAINER_RECORD_SIZE(width, limb_size);
+    }
+    *size = NOAHZK_CONTAINER_HEADER_SIZE + records_size + 8*count;
+    uint8_t* const base = calloc(*size, 1);
+
+    memcpy(base, NOAHZK_CONTAINER_MAGIC, 8);
+    base[8] = NOAHZK_CONTAINER_VERSION;
+    base[12] = (uint8_t)limb_size;
+    base[13] = endianness;
+    NOAHZK_container_put64(base + 16, count);
+    NOAHZK_container_put64(base + 32, NOAHZK_CONTAINER_HEADER_SIZE);
+    NOAHZK_container_put64(base + 40, NOAHZK_CONTAINER_HEADER_SIZE + records_size);
+
+    size_t offset = NOAHZK_CONTAINER_HEADER_SIZE;
+    for(size_t i = 0; i < count; i++){
+        const size_t bytes = NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(values[i].width), width = NOAHZK_SIZE_AS_ARR_OF_TYPE(bytes, limb_size);
+        const size_t record_size = NOAHZK_CONTAINER_RECORD_SIZE(width, limb_size);
+        const uint8_t extension = (uint8_t)-values[i].sign;
+        NOAHZK_container_put64(base + NOAHZK_CONTAINER_HEADER_SIZE + records_size + 8*i, offset);
+        NOAHZK_container_put64(base + offset, width);
+        NOAHZK_container_put64(base + offset + 8, values[i].sign);
+
+// byte k of the value goes to byte k % limb_size of limb k/limb_size, counted from whichever end the byte order starts at
+        uint8_t* const limbs = base + offset + 16;
+        memset(limbs, extension, record_size - 16);
+        for(size_t k = 0; k < bytes; k++){
+            const size_t b = k%limb_size, position = k - b + (endianness == NOAHZK_CONTAINER_LITTLE_ENDIAN? b: limb_size - 1 - b);
+            limbs[position] = (uint8_t)(values[i].arr[k/sizeof(NOAHZK_limb_t)] >> 8*(k%sizeof(NOAHZK_limb_t)));
+        }
+        offset += record_size;
+    }
+    return base;
+}
+
+// containers as a cpu with limb_size-byte limbs & the given byte order would write them; they can be viewed where the byte orders match,
+// & with limbs of the other size only on little-endian cpus
+void NOAHZK_test_foreign(const size_t limb_size, const uint8_t endianness){
+    const size_t widths[] = {0, 1, 2, 3, 7, 8, 9, 20};
+    const size_t count = sizeof(widths)/sizeof(widths[0]);
+    NOAHZK_variable_width_t* const values = NOAHZK_test_values(widths, count);
+    size_t size;
+    uint8_t* const base = NOAHZK_test_encode(values, count, limb_size, endianness, &size);
+    const int view = endianness == NOAHZK_container_host_endianness() && (endianness == NOAHZK_CONTAINER_LITTLE_ENDIAN || limb_size == sizeof(NOAHZK_limb_t));
+    char form[64];
+    snprintf(form, sizeof(form), "%zu-bit %s-endian limbs", 8*limb_size, endianness == NOAHZK_CONTAINER_LITTLE_ENDIAN? "little": "big");
+
+    NOAHZK_container_t container;
+    if(NOAHZK_test_expect(NOAHZK_container_open_memory(&container, base, size), "container", form)){
+        NOAHZK_test_records(&container, values, count, view, form);
+        NOAHZK_container_close(&container);
+    }
+
+    free(base);
+    NOAHZK_test_values_destroy(values, count);
+}
+
+int main(void){
+    const size_t widths[] = {0, 1, 2, 3, 4, 5, 5, 1, 0, 3, 4, 2};
+    NOAHZK_test_round_trip(widths, sizeof(widths)/sizeof(widths[0]), 5);
+
+    const size_t indexed[] = {0, 1, 2, 3, 40, 7, 0, 300, 1, 65, 2, 33};
+    NOAHZK_test_round_trip(indexed, sizeof(indexed)/sizeof(indexed[0]), 0);
+
+    NOAHZK_test_foreign(4, NOAHZK_CONTAINER_LITTLE_ENDIAN);
+    NOAHZK_test_foreign(4, NOAHZK_CONTAINER_BIG_ENDIAN);
+    NOAHZK_test_foreign(8, NOAHZK_CONTAINER_LITTLE_ENDIAN);
+    NOAHZK_test_foreign(8, NOAHZK_CONTAINER_BIG_ENDIAN);
+
+    return NOAHZK_test_report("container");
+}
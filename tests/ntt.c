@@ -0,0 +1,70 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+// checks the NTT multiplication directly, against the tiers below it: NOAHZK_MUL_NTT_THRESHOLD keeps NOAHZK_variable_width_mul_dispatch
+// from picking the NTT at these widths, so the two are computed independently. balanced & unbalanced widths, random & all-ones operands
+// (whose convolution coefficients are the largest the CRT has to get back), squares & a dst aliasing its source.
+
+#include "test.h"           // checks & the report
+
+// fixed-seed xorshift, so a failure can be reproduced
+uint64_t NOAHZK_test_state = 0x9e3779b97f4a7c15;
+
+NOAHZK_limb_t NOAHZK_test_random_limb(void){
+    NOAHZK_test_state ^= NOAHZK_test_state << 13;
+    NOAHZK_test_state ^= NOAHZK_test_state >> 7;
+    NOAHZK_test_state ^= NOAHZK_test_state << 17;
+    return (NOAHZK_limb_t)NOAHZK_test_state;
+}
+
+// rs0 is width0 limbs of ones if ones is set, random otherwise; rs1 likewise. rs0*rs1 is width0 + width1 limbs & rs0^2 2*width0
+void NOAHZK_test_ntt(const size_t width0, const size_t width1, const int ones){
+    const size_t width = width0 + NOAHZK_MAX(width0, width1);
+    NOAHZK_limb_t* const rs0 = malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width0)), *const rs1 = malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width1));
+    NOAHZK_limb_t* const ntt = malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width)), *const expected = malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    for(size_t i = 0; i < width0; i++) rs0[i] = ones? NOAHZK_LIMB_MAX: NOAHZK_test_random_limb();
+    for(size_t i = 0; i < width1; i++) rs1[i] = ones? NOAHZK_LIMB_MAX: NOAHZK_test_random_limb();
+    char form[64];
+
+    snprintf(form, sizeof(form), "%zu x %zu%s", width0, width1, ones? ", ones": "");
+    NOAHZK_variable_width_mul_dispatch(expected, rs0, rs1, width0, width1);
+    NOAHZK_test_expect(NOAHZK_variable_width_mul_ntt(ntt, rs0, rs1, width0, width1), "ntt", form);
+    NOAHZK_test_expect(!memcmp(ntt, expected, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width0 + width1)), "ntt", form);
+
+// rs0 squared, once into a separate dst & once into one that starts out holding rs0
+    snprintf(form, sizeof(form), "%zu squared%s", width0, ones? ", ones": "");
+    NOAHZK_variable_width_mul_dispatch(expected, rs0, rs0, width0, width0);
+    NOAHZK_test_expect(NOAHZK_variable_width_mul_ntt(ntt, rs0, rs0, width0, width0), "ntt", form);
+    NOAHZK_test_expect(!memcmp(ntt, expected, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(2*width0)), "ntt", form);
+
+    NOAHZK_limb_t* const aliased = malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(2*width0));
+    memcpy(aliased, rs0, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width0));
+    snprintf(form, sizeof(form), "%zu squared in place%s", width0, ones? ", ones": "");
+    NOAHZK_test_expect(NOAHZK_variable_width_mul_ntt(aliased, aliased, aliased, width0, width0), "ntt", form);
+    NOAHZK_test_expect(!memcmp(aliased, expected, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(2*width0)), "ntt", form);
+
+    free(rs0);
+    free(rs1);
+    free(ntt);
+    free(expected);
+    free(aliased);
+}
+
+int main(void){
+    const size_t widths[][2] = {
+        {1, 1}, {1, 37}, {5, 5}, {33, 2}, {17, 300}, {64, 64}, {100, 1}, {129, 700},
+        {384, 385}, {513, 2000}, {1000, 999}, {3000, 2048}, {4096, 31},
+    };
+
+    for(size_t i = 0; i < sizeof(widths)/sizeof(widths[0]); i++){
+        NOAHZK_test_ntt(widths[i][0], widths[i][1], 0);
+        NOAHZK_test_ntt(widths[i][0], widths[i][1], 1);
+    }
+
+    return NOAHZK_test_report("ntt");
+}
@@ -0,0 +1,185 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+// checks decimal conversion both ways: known vectors against hex, powers of ten (& one less) from a single limb's worth of digits to
+// well past NOAHZK_RADIX_DC_THRESHOLD limbs' worth, against powers computed by NOAHZK_variable_width_pow_and_resize_vartime, negatives, zero,
+// leading zeros, truncation into a fixed-width dst, & strings from_dec has to reject without touching dst.
+
+#include "test.h"           // checks & the report
+
+typedef struct{
+    const char* dec;            // as NOAHZK_variable_width_to_dec writes it
+    const char* hex;
+} NOAHZK_test_radix_vector_t;
+
+const NOAHZK_test_radix_vector_t NOAHZK_test_radix_vectors[] = {
+    {"0", "0"},
+    {"1", "1"},
+    {"-1", "-1"},
+    {"9", "9"},
+    {"10", "a"},
+    {"999999999", "3b9ac9ff"},
+    {"1000000000", "3b9aca00"},
+    {"-1000000000", "-3b9aca00"},
+    {"4294967295", "ffffffff"},
+    {"4294967296", "100000000"},
+    {"9223372036854775808", "8000000000000000"},
+    {"-9223372036854775808", "-8000000000000000"},
+    {"18446744073709551615", "ffffffffffffffff"},
+    {"18446744073709551616", "10000000000000000"},
+    {"9999999999999999999", "8ac7230489e7ffff"},
+    {"10000000000000000000", "8ac7230489e80000"},
+    {"-10000000000000000000", "-8ac7230489e80000"},
+    {"100000000000000000000000000000000000001", "4b3b4ca85a86c47a098a224000000001"},
+    {"1240442240206455154367629836214392230186771899873660907334870151435313919377943420913128817613745593172767436680351406243093728332198285544710269365337439685768964881148027350817551686351935249892460609897116464", "3c5ea97b98064464b7548ff30e06c5060db9fe638bb7c2120093b159d215839a0f5444a7ee8916545e6a264a04c35b8b990cddfc8057382245e9f312e565c1f7da967c8182fef61688dcac3e061e84218c84d1f56963330"},
+    {"-1079015370306242356975799918760670966146061398588982288021128686216022704236104171972133770506064906043970223844814892996057949041038197529444693209769729942292277903252732010339468040869711349244252264428153241661380710201743778688218864879597934322179013111612465020362757866635353218243833344324896", "-19c7835d06b6d418b0fd5713f781d041924b9a576e27ba1f093d806f3e1c066d914d0f292558de6b0d5dd15e1e4b36ad0521c70a22eb257dbd0e4a6cb0769b0c7915434a71931285c860200bb7b4dc59dc4971a55be007a16d7c78eab7a5f17968efc0abdfa51f1ce3d432483fc76a3fe04473fdb43d52ff3062ac7520"},
+    {"938673621832083735267730483079839318681401551139256920155622418960106948150939832784746776079925812756493936417704835094251372867701598768424604987441994571761233035150504808569099651152629910553397074824732943852172977486249469218384106923343124043773163890837770061421875243716619807868219802037621801092879748843922403277488355999762391034901289052400308504805991470276739231352484130857845943637996553586495239609335729939185170472682110187692460174295567966434026270348937682621192389931404562647928071335875281258417546775538722508582043205689455068202460554370983504171997279499826401214465043812470888138961078504937180339203799304075866506067470014292128409388749456803543866515438399246864620559022577774004637261686462133119996105395092149203347692794218068471345192706711386404469660739624149045498251649049483465601658744386970971110860112061344863321640322467718903287491191950080989386638", "c35452b4601c0c44389fd976cc17d98bc0f1ef230b02ce3fa473ee9e7eb00de81881d491fe689b446ce4fccbe44af578bb0b05952f6002b28562ac381a32a3e93e6485b52a33f0e512db47edbc4339ace655a679aa813601cf0739e3398ddae8ebc9df7ed6880d3266a64f0b03360bffc50884fc6734b042fa16a41493ef85eb1dcaf45c2367a2a4da9b204196db629b84f3b911d9d0139de92f966f4c2e58f0506ee634e0b5329b7dea09011098c8ebec078a074fcd40cd0d7f72385461b2c343bc1a2724a3414d85f26680e3d6df8f06fab317aadc18efbff8cc5332befb60ec6ba0eb52756e6e47838e9b64f6923a77d4bf5c203c1a78e601068701b3c0fb5a9affc96693854e647ce0570098df18e0eefd73ce4302aecbc2effbab5c9e771f8b376d19f190be1ac3b025fd518c9e25be35d0b052b1478d0c6802b350048b701b5173e1db7fee9161dd5ef48fbc3513736c78fb485832ac8f41004fa7d5b268405773f89a73349fb2a8ad0765e709abf167e126d78e"},
+};
+
+// malformed strings: nothing, a sign alone, signs other than a single leading '-', hex digits, spaces, a "0x" prefix, a decimal point, an exponent
+// & a non-ASCII digit (Arabic-Indic one, in UTF-8)
+const char* const NOAHZK_test_radix_invalid[] = {"", "-", "+1", "--1", "1-", "-+1", "12a", "a12", " 1", "1 ", "1 2", "0x10", "1.0", "1e9", "\xd9\xa1"};
+
+// var in decimal, with the default workspace & with scratch from the caller; & a dst a char too small, which gets nothing
+void NOAHZK_test_to_dec(const char* const op, const NOAHZK_variable_width_t* const var, const char* const expected){
+    const size_t size = NOAHZK_variable_width_to_dec_size(var);
+    char* const dec = malloc(size);
+    NOAHZK_limb_t* const scratch = malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(NOAHZK_variable_width_to_dec_scratch_size(var)));
+
+    NOAHZK_test_expect(NOAHZK_variable_width_to_dec(dec, size, var) == strlen(expected), op, "to_dec length");
+    NOAHZK_test_check_hex(op, "to_dec", dec, expected);
+    memset(dec, 0, size);
+    NOAHZK_test_expect(NOAHZK_variable_width_to_dec_scratch(dec, size, var, scratch) == strlen(expected), op, "to_dec_scratch length");
+    NOAHZK_test_check_hex(op, "to_dec_scratch", dec, expected);
+
+    dec[0] = 'x';
+    NOAHZK_test_expect(!NOAHZK_variable_width_to_dec(dec, size - 1, var) && dec[0] == 'x', op, "to_dec into too small a dst");
+    free(dec);
+    free(scratch);
+}
+
+// dec parsed into a var sized to fit, then into one exactly as wide as that, with the default workspace & with scratch from the caller
+void NOAHZK_test_from_dec(const char* const op, const char* const dec, const char* const expected){
+    NOAHZK_variable_width_t r = NOAHZK_variable_width_INITIALISER, fixed = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_test_expect(NOAHZK_variable_width_from_dec_and_resize(&r, dec), op, "from_dec_and_resize accepts it");
+    NOAHZK_test_check(op, "from_dec_and_resize", &r, expected);
+
+    NOAHZK_test_init(&fixed, r.width);
+    NOAHZK_test_expect(NOAHZK_variable_width_from_dec(&fixed, dec), op, "from_dec accepts it");
+    NOAHZK_test_check(op, "from_dec", &fixed, expected);
+
+    NOAHZK_limb_t* const scratch = malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(NOAHZK_variable_width_from_dec_scratch_size(strlen(dec))));
+    NOAHZK_variable_width_from_hex(&fixed, "0");
+    NOAHZK_test_expect(NOAHZK_variable_width_from_dec_scratch(&fixed, dec, scratch), op, "from_dec_scratch accepts it");
+    NOAHZK_test_check(op, "from_dec_scratch", &fixed, expected);
+    free(scratch);
+
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&fixed, NOAHZK_variable_width_keep_ptr);
+}
+
+// both ways for value, which has to be in canonical decimal
+void NOAHZK_test_both_ways(const char* const op, const NOAHZK_variable_width_t* const value, const char* const dec){
+    const size_t size = NOAHZK_variable_width_to_hex_size(value);
+    char* const hex = malloc(size);
+    NOAHZK_variable_width_to_hex(hex, size, value);
+    NOAHZK_test_to_dec(op, value, dec);
+    NOAHZK_test_from_dec(op, dec, hex);
+    free(hex);
+}
+
+// 10^digits, 10^digits - 1 & -10^digits, against 10^digits from pow_and_resize_vartime
+void NOAHZK_test_power_of_ten(const size_t digits){
+    char* const dec = malloc(digits + 3);
+    char exponent[2 + 2*sizeof(size_t)];
+    snprintf(exponent, sizeof(exponent), "%zx", digits);
+    NOAHZK_variable_width_t ten = NOAHZK_variable_width_INITIALISER, e = NOAHZK_variable_width_INITIALISER, power = NOAHZK_variable_width_INITIALISER, r = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_variable_width_from_hex_and_resize(&ten, "a");
+    NOAHZK_variable_width_from_hex_and_resize(&e, exponent);
+    NOAHZK_variable_width_pow_and_resize_vartime(&power, &ten, &e);
+
+    dec[0] = '1';
+    memset(dec + 1, '0', digits);
+    dec[digits + 1] = '\0';
+    NOAHZK_test_both_ways("10^k", &power, dec);
+
+    memmove(dec + 1, dec, digits + 2);
+    dec[0] = '-';
+    NOAHZK_variable_width_from_hex(&ten, "0");
+    NOAHZK_variable_width_sub_and_resize(&r, &ten, &power);
+    NOAHZK_test_both_ways("-10^k", &r, dec);
+
+    if(digits){
+        memset(dec, '9', digits);
+        dec[digits] = '\0';
+        NOAHZK_variable_width_sub_and_resize_constant(&r, &power, 1);
+        NOAHZK_test_both_ways("10^k - 1", &r, dec);
+    }
+
+    NOAHZK_variable_width_destroy(&ten, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&e, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&power, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+    free(dec);
+}
+
+// strings that aren't canonical but are valid, & a value that doesn't fit in a one-limb dst, which keeps the low limb
+void NOAHZK_test_noncanonical(void){
+    const char* const dec[] = {"-0", "000", "-000", "0000000000000000000000000000000000000000000123", "-00123"};
+    const char* const hex[] = {"0", "0", "0", "7b", "-7b"};
+    for(size_t i = 0; i < sizeof(dec)/sizeof(dec[0]); i++) NOAHZK_test_from_dec("leading zeros", dec[i], hex[i]);
+
+// 2^64 + 1 & 2^64 - 1, truncated to one limb: 1 either way, & -1 either way
+    NOAHZK_variable_width_t r = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_test_init(&r, 1);
+    NOAHZK_test_expect(NOAHZK_variable_width_from_dec(&r, "18446744073709551617"), "truncated", "from_dec accepts it");
+    NOAHZK_test_check("truncated", "from_dec", &r, "1");
+    NOAHZK_test_expect(NOAHZK_variable_width_from_dec(&r, "18446744073709551615"), "truncated", "from_dec accepts it");
+    NOAHZK_test_check("truncated", "from_dec", &r, "-1");
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+
+// a var no limbs wide is 0
+    NOAHZK_test_to_dec("zero width", &r, "0");
+}
+
+// every malformed string has to be turned down by each form, leaving dst as it was
+void NOAHZK_test_invalid(void){
+    NOAHZK_variable_width_t r = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_variable_width_from_hex_and_resize(&r, "-2a");
+    NOAHZK_limb_t scratch[64];
+
+    for(size_t i = 0; i < sizeof(NOAHZK_test_radix_invalid)/sizeof(NOAHZK_test_radix_invalid[0]); i++){
+        const char* const dec = NOAHZK_test_radix_invalid[i];
+        NOAHZK_test_expect(!NOAHZK_variable_width_from_dec(&r, dec), dec, "from_dec rejects it");
+        NOAHZK_test_expect(!NOAHZK_variable_width_from_dec_scratch(&r, dec, scratch), dec, "from_dec_scratch rejects it");
+        NOAHZK_test_expect(!NOAHZK_variable_width_from_dec_and_resize(&r, dec), dec, "from_dec_and_resize rejects it");
+        NOAHZK_test_check(dec, "dst left as it was", &r, "-2a");
+    }
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+}
+
+int main(void){
+    for(size_t i = 0; i < sizeof(NOAHZK_test_radix_vectors)/sizeof(NOAHZK_test_radix_vectors[0]); i++){
+        const NOAHZK_test_radix_vector_t* const v = &NOAHZK_test_radix_vectors[i];
+        NOAHZK_variable_width_t value = NOAHZK_variable_width_INITIALISER;
+        NOAHZK_variable_width_from_hex_and_resize(&value, v->hex);
+        NOAHZK_test_to_dec("vector", &value, v->dec);
+        NOAHZK_test_from_dec("vector", v->dec, v->hex);
+        NOAHZK_variable_width_destroy(&value, NOAHZK_variable_width_keep_ptr);
+    }
+
+// either side of a limb's worth of digits & of NOAHZK_RADIX_DC_THRESHOLD limbs' worth, for either limb width, then a few levels of splits
+    const size_t digits[] = {0, 1, 8, 9, 10, 18, 19, 20, 38, 143, 144, 145, 152, 153, 303, 304, 305, 608, 1000, 2433, 5000, 20000};
+    for(size_t i = 0; i < sizeof(digits)/sizeof(digits[0]); i++) NOAHZK_test_power_of_ten(digits[i]);
+
+    NOAHZK_test_noncanonical();
+    NOAHZK_test_invalid();
+
+    NOAHZK_radix_powers_release();
+    return NOAHZK_test_report("radix");
+}
@@ -0,0 +1,173 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+// checks the shifts: known vectors through the _and_resize forms, then every form (left, logical right & arithmetic right; funnelled,
+// _and_resize & barrel; into a separate dst & in place) against a bit-at-a-time reference, by 0, by one bit either side of each multiple
+// of the limb size & by amounts past both widths, on sources of either sign & dsts narrower & wider than them.
+
+#include "test.h"           // checks & the report
+
+typedef struct{
+    const char* op;             // shl, shr (logical) or sar (arithmetic)
+    const char* a;
+    size_t shamt;
+    const char* expected;       // as NOAHZK_variable_width_to_hex writes it
+} NOAHZK_test_vector_t;
+
+// the same at either limb width: shr reads a past its width as 0, & a's width is what from_hex makes of it, so those have a >= 0
+const NOAHZK_test_vector_t NOAHZK_test_vectors[] = {
+    {"shl", "1", 0, "1"},
+    {"shl", "1", 64, "10000000000000000"},
+    {"shl", "-1", 100, "-10000000000000000000000000"},
+    {"shl", "123456789abcdef0123", 4, "123456789abcdef01230"},
+    {"shl", "-123456789abcdef0123", 33, "-2468acf13579bde024600000000"},
+    {"shl", "0", 1000, "0"},
+    {"shr", "123456789abcdef0123", 0, "123456789abcdef0123"},
+    {"shr", "123456789abcdef0123", 4, "123456789abcdef012"},
+    {"shr", "123456789abcdef0123", 64, "123"},
+    {"shr", "123456789abcdef0123", 68, "12"},
+    {"shr", "123456789abcdef0123", 77, "0"},
+    {"shr", "123456789abcdef0123", 1000, "0"},
+    {"sar", "-123456789abcdef0123", 0, "-123456789abcdef0123"},
+    {"sar", "-123456789abcdef0123", 4, "-123456789abcdef013"},
+    {"sar", "-123456789abcdef0120", 4, "-123456789abcdef012"},
+    {"sar", "-123456789abcdef0123", 64, "-124"},
+    {"sar", "-10000000000000000", 64, "-1"},
+    {"sar", "-1", 1000, "-1"},
+    {"sar", "7fffffffffffffff", 62, "1"},
+    {"sar", "7fffffffffffffff", 1000, "0"},
+};
+
+// fixed-seed xorshift, so a failure can be reproduced
+uint64_t NOAHZK_test_state = 0x9e3779b97f4a7c15;
+
+NOAHZK_limb_t NOAHZK_test_random_limb(void){
+    NOAHZK_test_state ^= NOAHZK_test_state << 13;
+    NOAHZK_test_state ^= NOAHZK_test_state >> 7;
+    NOAHZK_test_state ^= NOAHZK_test_state << 17;
+    return (NOAHZK_limb_t)NOAHZK_test_state;
+}
+
+// bit j of var, extended past its width by its sign, or by 0 if logical is set
+NOAHZK_limb_t NOAHZK_test_bit(const NOAHZK_variable_width_t* const var, const size_t j, const int logical){
+    if(j/BITS_IN_NOAHZK_LIMB >= var->width) return logical? 0: var->sign;
+    return var->arr[j/BITS_IN_NOAHZK_LIMB] >> j%BITS_IN_NOAHZK_LIMB & 1;
+}
+
+// bit j of src shifted by shamt, one bit at a time
+NOAHZK_limb_t NOAHZK_test_shifted_bit(const NOAHZK_variable_width_t* const src, const size_t j, const size_t shamt, const char* const op){
+    const int logical = !strcmp(op, "shr");
+    if(!strcmp(op, "shl")) return j < shamt? 0: NOAHZK_test_bit(src, j - shamt, 0);
+// past every bit src has, whatever's shifted in
+    if(shamt > SIZE_MAX - j) return logical? 0: src->sign;
+    return NOAHZK_test_bit(src, j + shamt, logical);
+}
+
+// dst against src shifted by shamt, over dst's width (truncated) if it's fixed, or the whole value if it was resized. dst's sign has to be
+// its top bit, except after a logical shift was resized: that one's always 0, as the shifted in 0s are dropped with the limbs they fill
+int NOAHZK_test_shifted(const NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const size_t shamt, const char* const op, const int resized){
+    const size_t bits = resized? (src->width + 2)*BITS_IN_NOAHZK_LIMB + shamt: dst->width*BITS_IN_NOAHZK_LIMB;
+    int ok = dst->sign == (resized && !strcmp(op, "shr")? 0: dst->width? dst->arr[dst->width - 1] >> (BITS_IN_NOAHZK_LIMB - 1): 0);
+    for(size_t j = 0; j < bits; j++) ok &= NOAHZK_test_bit(dst, j, 0) == NOAHZK_test_shifted_bit(src, j, shamt, op);
+    return ok;
+}
+
+// src shifted by op & shamt, by the form named, into dst (whose width is kept)
+void NOAHZK_test_apply(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const size_t shamt, const char* const op, const int barrel){
+    if(!strcmp(op, "shl")) (barrel? NOAHZK_variable_width_shift_left_barrel: NOAHZK_variable_width_shift_left)(dst, src, shamt);
+    else if(!strcmp(op, "shr")) (barrel? NOAHZK_variable_width_shift_right_barrel: NOAHZK_variable_width_shift_right)(dst, src, shamt);
+    else (barrel? NOAHZK_variable_width_shift_right_arithmetic_barrel: NOAHZK_variable_width_shift_right_arithmetic)(dst, src, shamt);
+}
+
+void NOAHZK_test_apply_and_resize(NOAHZK_variable_width_t* const dst, const NOAHZK_variable_width_t* const src, const size_t shamt, const char* const op){
+    if(!strcmp(op, "shl")) NOAHZK_variable_width_shift_left_and_resize(dst, src, shamt);
+    else if(!strcmp(op, "shr")) NOAHZK_variable_width_shift_right_and_resize(dst, src, shamt);
+    else NOAHZK_variable_width_shift_right_arithmetic_and_resize(dst, src, shamt);
+}
+
+// src by every form of op, into dsts of each width in widths & in place
+void NOAHZK_test_shift(const NOAHZK_variable_width_t* const src, const size_t shamt, const char* const op, const int resize){
+    const size_t widths[] = {src->width, src->width + 2, src->width? src->width - 1: 0, 1};
+    NOAHZK_variable_width_t dst = NOAHZK_variable_width_INITIALISER;
+    char form[96];
+
+    for(int barrel = 0; barrel <= 1; barrel++){
+        const char* const kind = barrel? "barrel": "funnelled";
+        for(size_t i = 0; i < sizeof(widths)/sizeof(widths[0]); i++){
+            NOAHZK_test_init(&dst, widths[i]);
+            NOAHZK_test_apply(&dst, src, shamt, op, barrel);
+            snprintf(form, sizeof(form), "%s, %zu limbs by %zu into %zu", kind, src->width, shamt, widths[i]);
+            NOAHZK_test_expect(NOAHZK_test_shifted(&dst, src, shamt, op, 0), op, form);
+            NOAHZK_variable_width_destroy(&dst, NOAHZK_variable_width_keep_ptr);
+        }
+
+        NOAHZK_test_init(&dst, src->width);
+        if(src->width) memcpy(dst.arr, src->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(src->width));
+        dst.sign = src->sign;
+        NOAHZK_test_apply(&dst, &dst, shamt, op, barrel);
+        snprintf(form, sizeof(form), "%s, %zu limbs by %zu in place", kind, src->width, shamt);
+        NOAHZK_test_expect(NOAHZK_test_shifted(&dst, src, shamt, op, 0), op, form);
+        NOAHZK_variable_width_destroy(&dst, NOAHZK_variable_width_keep_ptr);
+    }
+    if(!resize) return;
+
+// resized, nothing but the bits shifted out on the right is lost
+    NOAHZK_test_apply_and_resize(&dst, src, shamt, op);
+    snprintf(form, sizeof(form), "and_resize, %zu limbs by %zu", src->width, shamt);
+    NOAHZK_test_expect(NOAHZK_test_shifted(&dst, src, shamt, op, 1), op, form);
+    NOAHZK_variable_width_destroy(&dst, NOAHZK_variable_width_keep_ptr);
+
+    NOAHZK_test_init(&dst, src->width);
+    if(src->width) memcpy(dst.arr, src->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(src->width));
+    dst.sign = src->sign;
+    NOAHZK_test_apply_and_resize(&dst, &dst, shamt, op);
+    snprintf(form, sizeof(form), "and_resize, %zu limbs by %zu in place", src->width, shamt);
+    NOAHZK_test_expect(NOAHZK_test_shifted(&dst, src, shamt, op, 1), op, form);
+    NOAHZK_variable_width_destroy(&dst, NOAHZK_variable_width_keep_ptr);
+}
+
+// sources of width limbs: random (of either sign), -1, the most negative value & the most positive one
+void NOAHZK_test_shifts(const size_t width){
+    const char* const ops[] = {"shl", "shr", "sar"};
+    const size_t bits = width*BITS_IN_NOAHZK_LIMB, L = BITS_IN_NOAHZK_LIMB;
+    const size_t shamts[] = {0, 1, L - 1, L, L + 1, 2*L - 1, 2*L, 3*L, bits? bits - 1: 0, bits, bits + 1, bits + 2*L, 4*bits + 3};
+    NOAHZK_variable_width_t src = NOAHZK_variable_width_INITIALISER;
+
+    for(size_t value = 0; value < 5; value++){
+        NOAHZK_test_init(&src, width);
+        for(size_t i = 0; i < width; i++) src.arr[i] = value < 2? NOAHZK_test_random_limb(): value == 3? 0: NOAHZK_LIMB_MAX;
+        if(width && value == 3) src.arr[width - 1] = (NOAHZK_limb_t)1 << (L - 1);
+        if(width && value == 4) src.arr[width - 1] >>= 1;
+        if(width && value == 1) src.arr[width - 1] ^= (NOAHZK_limb_t)1 << (L - 1);
+        if(width) NOAHZK_variable_width_update_sign(&src);
+
+        for(size_t o = 0; o < sizeof(ops)/sizeof(ops[0]); o++){
+            for(size_t s = 0; s < sizeof(shamts)/sizeof(shamts[0]); s++) NOAHZK_test_shift(&src, shamts[s], ops[o], 1);
+// too far for the _and_resize shifts to make room for
+            NOAHZK_test_shift(&src, SIZE_MAX, ops[o], 0);
+        }
+        NOAHZK_variable_width_destroy(&src, NOAHZK_variable_width_keep_ptr);
+    }
+}
+
+int main(void){
+    for(size_t i = 0; i < sizeof(NOAHZK_test_vectors)/sizeof(NOAHZK_test_vectors[0]); i++){
+        const NOAHZK_test_vector_t* const v = &NOAHZK_test_vectors[i];
+        NOAHZK_variable_width_t a = NOAHZK_variable_width_INITIALISER, r = NOAHZK_variable_width_INITIALISER;
+        NOAHZK_variable_width_from_hex_and_resize(&a, v->a);
+        NOAHZK_test_apply_and_resize(&r, &a, v->shamt, v->op);
+        NOAHZK_test_check(v->op, "and_resize", &r, v->expected);
+        NOAHZK_variable_width_destroy(&a, NOAHZK_variable_width_keep_ptr);
+        NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+    }
+
+    const size_t widths[] = {0, 1, 2, 3, 5};
+    for(size_t i = 0; i < sizeof(widths)/sizeof(widths[0]); i++) NOAHZK_test_shifts(widths[i]);
+
+    return NOAHZK_test_report("shift");
+}
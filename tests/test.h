@@ -0,0 +1,77 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+// what every test program shares: counting checks, comparing results as hex strings & the closing report.
+// each program is built once with 32-bit limbs & once with 64-bit ones; see the Makefile.
+
+#ifndef NOAHZK_bigint_test_included
+#define NOAHZK_bigint_test_included
+
+#include "../NOAHZK_bigint_lib/noahzk_bigint.h"
+#include "stdio.h"          // printf, snprintf
+#include "stdlib.h"         // malloc, free
+#include "string.h"         // strcmp, memset
+
+size_t NOAHZK_test_checks = 0, NOAHZK_test_failures = 0;
+
+// counts a check that passed if ok is nonzero & reports it otherwise; returns ok
+int NOAHZK_test_expect(const int ok, const char* const op, const char* const form){
+    NOAHZK_test_checks++;
+    if(!ok){
+        NOAHZK_test_failures++;
+        printf("FAIL %s (%s)\n", op, form);
+    }
+    return ok;
+}
+
+void NOAHZK_test_check_hex(const char* const op, const char* const form, const char* const hex, const char* const expected){
+    NOAHZK_test_checks++;
+    if(strcmp(hex, expected)){
+        NOAHZK_test_failures++;
+        printf("FAIL %s (%s): got %.64s, expected %.64s\n", op, form, hex, expected);
+    }
+}
+
+// compares result with expected, written as NOAHZK_variable_width_to_hex writes it
+void NOAHZK_test_check(const char* const op, const char* const form, const NOAHZK_variable_width_t* const result, const char* const expected){
+    const size_t size = NOAHZK_variable_width_to_hex_size(result);
+    char* const hex = malloc(size);
+    NOAHZK_variable_width_to_hex(hex, size, result);
+    NOAHZK_test_check_hex(op, form, hex, expected);
+    free(hex);
+}
+
+// for results that are plain numbers (comparisons, bit counts); written in hex like the vars are
+void NOAHZK_test_check_number(const char* const op, const char* const form, const long long result, const char* const expected){
+    char hex[2 + 2*sizeof(result)];
+    snprintf(hex, sizeof(hex), "%s%llx", result < 0? "-": "", result < 0? -(unsigned long long)result: (unsigned long long)result);
+    NOAHZK_test_check_hex(op, form, hex, expected);
+}
+
+// a var width limbs wide, for the forms that keep dst's width
+void NOAHZK_test_init(NOAHZK_variable_width_t* const var, const size_t width){
+    NOAHZK_variable_width_init(var, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+}
+
+// var = hex, at exactly width limbs (sign-extended or truncated)
+void NOAHZK_test_init_hex(NOAHZK_variable_width_t* const var, const size_t width, const char* const hex){
+    NOAHZK_variable_width_t value = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_variable_width_from_hex_and_resize(&value, hex);
+    NOAHZK_test_init(var, width);
+    NOAHZK_variable_width_select(var, &value, &value, 0);
+    NOAHZK_variable_width_destroy(&value, NOAHZK_variable_width_keep_ptr);
+}
+
+// prints the tally & gives main's exit status: 1 if anything failed
+int NOAHZK_test_report(const char* const name){
+    NOAHZK_default_workspace_release();
+    printf("%s, %zu-bit limbs: %zu checks, %zu failed\n", name, (size_t)BITS_IN_NOAHZK_LIMB, NOAHZK_test_checks, NOAHZK_test_failures);
+    return NOAHZK_test_failures != 0;
+}
+
+#endif
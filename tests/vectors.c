@@ -0,0 +1,529 @@
+/*
+   NOAHZK_bigint reference source code package - reference C implementations
+
+   Copyright 2025, dedmanwalking <dedmanwalking@proton.me>.  You may use this under the
+   terms of the CC0 1.0 Universal license, linked below:
+   - CC0 1.0 Universal : http://creativecommons.org/publicdomain/zero/1.0
+*/
+
+// checks arithmetic, comparisons & bit counts against known vectors; `make test` builds it once with 32-bit limbs & once with 64-bit ones.
+// every vector goes through the constant-time, _and_resize & _vartime forms of its op, & the results are compared as hex strings.
+// exits with 1 if any of them is wrong.
+
+#include "test.h"           // checks & the report
+
+typedef struct{
+    const char* op;             // see below
+    const char* a;
+    const char* b;              // NULL for the ops that take one operand
+    const char* n;              // the modulus, for powmod
+    const char* expected;       // as NOAHZK_variable_width_to_hex writes it
+} NOAHZK_test_vector_t;
+
+// a + b, a - b, a + k & a - k (k being b, a 64-bit constant), -a, ~a, a <=> b (-1, 0 or 1) & a's two's complement width in bits (bitcnt);
+// a*b, a/b & a%b (rounded towards 0, so the remainder takes a's sign), a^b, a^b mod n, a*b mod n & a^2 mod n (sqrmod);
+// the modular ones include moduli over 32 limbs wide at either limb width, which Montgomery multiplication multiplies first & reduces after.
+// squares (sqr) are checked apart from the table, at widths either side of each squaring tier's threshold, which differ by limb width
+const NOAHZK_test_vector_t NOAHZK_test_vectors[] = {
+    {"add", "ffffffff", "1", NULL, "100000000"},
+    {"sub", "ffffffff", "1", NULL, "fffffffe"},
+    {"add", "ffffffffffffffff", "1", NULL, "10000000000000000"},
+    {"sub", "ffffffffffffffff", "1", NULL, "fffffffffffffffe"},
+    {"add", "-80000000", "-1", NULL, "-80000001"},
+    {"sub", "-80000000", "-1", NULL, "-7fffffff"},
+    {"add", "-8000000000000000", "-8000000000000000", NULL, "-10000000000000000"},
+    {"sub", "-8000000000000000", "-8000000000000000", NULL, "0"},
+    {"add", "123456789abcdef0123456789", "-123456789abcdef0123456789", NULL, "0"},
+    {"sub", "123456789abcdef0123456789", "-123456789abcdef0123456789", NULL, "2468acf13579bde02468acf12"},
+    {"add", "-1", "10000000000000000", NULL, "ffffffffffffffff"},
+    {"sub", "-1", "10000000000000000", NULL, "-10000000000000001"},
+    {"add", "7fffffffffffffffffffffffffffffff", "7fffffffffffffffffffffffffffffff", NULL, "fffffffffffffffffffffffffffffffe"},
+    {"sub", "7fffffffffffffffffffffffffffffff", "7fffffffffffffffffffffffffffffff", NULL, "0"},
+    {"add", "-deadbeefcafebabe1234", "55aa", NULL, "-deadbeefcafebabdbc8a"},
+    {"sub", "-deadbeefcafebabe1234", "55aa", NULL, "-deadbeefcafebabe67de"},
+    {"add", "0", "0", NULL, "0"},
+    {"sub", "0", "0", NULL, "0"},
+    {"add", "1", "-fedcba9876543210fedcba9876543210ff", NULL, "-fedcba9876543210fedcba9876543210fe"},
+    {"sub", "1", "-fedcba9876543210fedcba9876543210ff", NULL, "fedcba9876543210fedcba987654321100"},
+    {"addk", "ffffffff", "1", NULL, "100000000"},
+    {"subk", "ffffffff", "1", NULL, "fffffffe"},
+    {"addk", "-1", "1", NULL, "0"},
+    {"subk", "-1", "1", NULL, "-2"},
+    {"addk", "-10000000000000000", "ffffffffffffffff", NULL, "-1"},
+    {"subk", "-10000000000000000", "ffffffffffffffff", NULL, "-1ffffffffffffffff"},
+    {"addk", "123456789abcdef", "fedcba9876543210", NULL, "ffffffffffffffff"},
+    {"subk", "123456789abcdef", "fedcba9876543210", NULL, "-fdb97530eca86421"},
+    {"addk", "0", "0", NULL, "0"},
+    {"subk", "0", "0", NULL, "0"},
+    {"addk", "-5", "8000000000000000", NULL, "7ffffffffffffffb"},
+    {"subk", "-5", "8000000000000000", NULL, "-8000000000000005"},
+    {"addk", "ffffffffffffffffffffffff", "ffffffffffffffff", NULL, "100000000fffffffffffffffe"},
+    {"subk", "ffffffffffffffffffffffff", "ffffffffffffffff", NULL, "ffffffff0000000000000000"},
+    {"neg", "0", NULL, NULL, "0"},
+    {"inv", "0", NULL, NULL, "-1"},
+    {"neg", "1", NULL, NULL, "-1"},
+    {"inv", "1", NULL, NULL, "-2"},
+    {"neg", "-1", NULL, NULL, "1"},
+    {"inv", "-1", NULL, NULL, "0"},
+    {"neg", "7fffffff", NULL, NULL, "-7fffffff"},
+    {"inv", "7fffffff", NULL, NULL, "-80000000"},
+    {"neg", "-80000000", NULL, NULL, "80000000"},
+    {"inv", "-80000000", NULL, NULL, "7fffffff"},
+    {"neg", "-8000000000000000", NULL, NULL, "8000000000000000"},
+    {"inv", "-8000000000000000", NULL, NULL, "7fffffffffffffff"},
+    {"neg", "ffffffffffffffff", NULL, NULL, "-ffffffffffffffff"},
+    {"inv", "ffffffffffffffff", NULL, NULL, "-10000000000000000"},
+    {"neg", "-123456789abcdef0123456789abcdef", NULL, NULL, "123456789abcdef0123456789abcdef"},
+    {"inv", "-123456789abcdef0123456789abcdef", NULL, NULL, "123456789abcdef0123456789abcdee"},
+    {"cmp", "0", "0", NULL, "0"},
+    {"cmp", "1", "-1", NULL, "1"},
+    {"cmp", "-1", "1", NULL, "-1"},
+    {"cmp", "-100000000", "-ffffffff", NULL, "-1"},
+    {"cmp", "123456789abcdef0123", "123456789abcdef0123", NULL, "0"},
+    {"cmp", "ffffffffffffffff", "10000000000000000", NULL, "-1"},
+    {"cmp", "-10000000000000000", "-ffffffffffffffff", NULL, "-1"},
+    {"cmp", "5", "8000000000000000000000", NULL, "-1"},
+    {"cmp", "-8000000000000000000000", "-5", NULL, "-1"},
+    {"bitcnt", "0", NULL, NULL, "1"},
+    {"bitcnt", "-1", NULL, NULL, "1"},
+    {"bitcnt", "1", NULL, NULL, "2"},
+    {"bitcnt", "7fffffff", NULL, NULL, "20"},
+    {"bitcnt", "80000000", NULL, NULL, "21"},
+    {"bitcnt", "-80000000", NULL, NULL, "20"},
+    {"bitcnt", "-80000001", NULL, NULL, "21"},
+    {"bitcnt", "ffffffffffffffff", NULL, NULL, "41"},
+    {"bitcnt", "-8000000000000000", NULL, NULL, "40"},
+    {"bitcnt", "1ffffffffffffffffffff", NULL, NULL, "52"},
+    {"bitcnt", "-123456789abcdef0123456789", NULL, NULL, "62"},
+    {"mul", "-6e4660d5", "-148f165d5", NULL, "8db2282f95479a39"},
+    {"mul", "e8d605d4017f9ee6", "-c24458b6b6043106", NULL, "-b0b059f3f52819a0acf47fbb75ffbf64"},
+    {"mul", "-34d52bc614bedce030297c5e538f12d92", "-1be506564f3a160712456de76", NULL, "5c1bf9cdb5dce687d8f0c7cc98ca29fe9f1de3cf358f2e7e93bbb9d4c"},
+    {"mul", "cbd571b41b5669a0729b23994395a774f0147f76f87a640701ad82a1865506aadbf8319b25f81fcec1496e2769e927e4bf156405372ef440e5c51e9a508bb1f4c9da653868e6d9ca0bc36c", "32190b44045f9429523c4b037d52900977a9f2c943862c199bd3a49d1ce2844948a86c51ce927e89f918590825511600314ac9aee9cf6b978d7d421bb1235c9dc8b64f4e68e5c85bd78d", NULL, "27e3a1059bfded09ef34a63035b5a4cbf9ab454d6e0ff060ed4c97cdde554cc6240ddf27a02c89921535ef9122d13d19c6e5b344fee93122b2cdca34a5efdbea8719e0b0cfaa56d9aaf3e4f7ccbffe14ecce4ea7da22feeb20b1a5ee1599096f881f71dd80a0fa41d1ebe72dbf3173637efae04bdc9655e880ac50680e454d227441ac35e930f0f2872d3ec856c3bdc11b00fe567c"},
+    {"mul", "-de8718ee59279e167fdcf97eb6617ca3b757e78b50336bd24d9d8fbf7d457c805d33952a782cf767fcdb1c21401e13d9cef5bb5d53cea17744acda71f78ff04cbb5811fb2f1a709799eb9f8d702c255eb3435850394b6687dd5094cdd4240c6d7a962c671f4360e035868e5d98c2b45ba5681347b74fcfab3045b382a0caf8c10d3cf3f741ef82175fc623151001bc34de28c1a4f126160278deda97d6933b93c1be0d05f81639e85fbc05801952061ca532551fffc3436d523583b", "-c166d6b184d009a36b094ee655ab212736cce16486f459c3f01ee5d8c56b56f0c9a8190c583931afd224f1bce617471d14ea6dd7dce2f3eb3370a30bedb95ca026140364f1c8ad0256edf73e3df8581f1b98cf8aafa68217d73a17b523aa1d19d4dd9c51ea0edc3a51d30212260288d1262610d4799caba7c880ddae402521c86713c7d057a682f3e8793bab2359e182d8eb367a3beae651c287fd9a9390de66671dd1a67152b9a8cc3a890b01f9a4", NULL, "a81d3e3edde05e4aaa7853ef266830ff56bfae6dbb2e1b26fa14c26a44543f9619d9ea6c7609866fba7ddf3a5f92bbfccff9d67fa0108eb2f4d8f008325d28bd725fb2cab309fe8733888c7365f0483f0fdcb18c518853b860216bc722ee882a940c59a0effdb5426fdaa7092eec066f10edf920bcd541ac5de99e4fd4a65e84747fecb853372589e82134b75e6189c86eea326fa3756db27ed2871053add10589fe4b0ba8a0eee38d03478a76ee28151451243b9d6048fe0008faa4cfa870c3c605edf5d9e41ba174859b00268f8a1fbe79b6dd8300e33b4db7b62ef814c7a72e7bf82372ffa64a457d9cf09cb324d4b894c3a6fe5b1ae0de3c04fe66a655f420a06185fba18aebda2169959de02226d5a848df29ea6297baebaa681469de2d77650069ebea88b012513e54afc281e08355d0eb0a7eca01b3cccfb7c0a629dd8e6e30ffbd9c7bf12b5f1fc5b72fd093e15d5882d9d619dcda7b2735f485d6e189114f4a5b7f0ccb0e8cc"},
+    {"mul", "-1", "ffffffffffffffff", NULL, "-ffffffffffffffff"},
+    {"mul", "0", "-123456789abcdef", NULL, "0"},
+    {"div", "-82da11fe95054119", "be93c80b", NULL, "-afc58708"},
+    {"mod", "-82da11fe95054119", "be93c80b", NULL, "-3c7233c1"},
+    {"div", "-896830a24c6369b758448162e025b15c8ba41237b91aa1e9e7", "-baf1c9cee23467e8", NULL, "bc29f09c9e4d6d0165697e443f5be8e2f9"},
+    {"mod", "-896830a24c6369b758448162e025b15c8ba41237b91aa1e9e7", "-baf1c9cee23467e8", NULL, "-a2777472fae093f"},
+    {"div", "-9daa3d948a4c3f61bb5ced0a1eee62b6a7b474b1d1ac6b73746d108cfe9124c1a71470f625c4b6e80ba69a3f799f380ecc88b6a415fb583aacb26fd6d761d8132bd65a8b50477ee07c390ab0f21a43909fe3d8c4287443b", "eec675559bde0478c1b21987030e20895662039c0213ccf5a5e66529702d72c6f9e2425136d", NULL, "-a909e4851a92b68233897f4dfb9a271b049b7a3031764ad2a2fe07c05ba609e43874f80ce9042b7df71d6b4704a40adb360d"},
+    {"mod", "-9daa3d948a4c3f61bb5ced0a1eee62b6a7b474b1d1ac6b73746d108cfe9124c1a71470f625c4b6e80ba69a3f799f380ecc88b6a415fb583aacb26fd6d761d8132bd65a8b50477ee07c390ab0f21a43909fe3d8c4287443b", "eec675559bde0478c1b21987030e20895662039c0213ccf5a5e66529702d72c6f9e2425136d", NULL, "-3e710bd428d9138ac055840528c7fe412162a2000b62c0aa7b8e3e7b2b16535b296ba4d49b2"},
+    {"div", "-a9043e2b9568b961b79efd9ab34141ffdbf5926a1ea1213c3671d6e145c5bba8dab51ea7d857282222f268580a00b777126794396e82022358aceea78e1f2b1a4f6679788cc1dfd3dd78d397fbd6ee2bcb601434e125d31c962b716fe453bb9c060826d1382052fd8f675851fae80aff9670fc54b82593e928d01cb4dfe13d57cfbd6da059f4850d8c625a66d35124ea882c725356dd6586873c6e0dc4a78c72c94c8ddd360bc0a7efec597aadccc735cc0a42c2f4203db65424273", "b5ba4a1744101df30db06c73914601b1095677264241144487b7e4a67032a0b5d46a33bb6010c80198eb4ef2be53c1f881931f955b7ceaa836b2b570d6dfab5c1504f25ba56656c7f19d964ce6a333c149bf2e9765de274", NULL, "-ee180563210d03c9f5658f728bcdde002271c83b283e73b41cb7b070b03c0d052c5e8547ddcedd97ba4a1cd5a00ca7f6624a716e458d420f1d3d7bd059d040de186cec9e0a5b1b8e1246fa3289c455dfdb197f7c83ea32ccdf47df6b70719ec92bdb18f7"},
+    {"mod", "-a9043e2b9568b961b79efd9ab34141ffdbf5926a1ea1213c3671d6e145c5bba8dab51ea7d857282222f268580a00b777126794396e82022358aceea78e1f2b1a4f6679788cc1dfd3dd78d397fbd6ee2bcb601434e125d31c962b716fe453bb9c060826d1382052fd8f675851fae80aff9670fc54b82593e928d01cb4dfe13d57cfbd6da059f4850d8c625a66d35124ea882c725356dd6586873c6e0dc4a78c72c94c8ddd360bc0a7efec597aadccc735cc0a42c2f4203db65424273", "b5ba4a1744101df30db06c73914601b1095677264241144487b7e4a67032a0b5d46a33bb6010c80198eb4ef2be53c1f881931f955b7ceaa836b2b570d6dfab5c1504f25ba56656c7f19d964ce6a333c149bf2e9765de274", NULL, "-648d1a6f8ef8df4a0a830331be06e82b243a1c10e5c6636f2a5f3eaf3acba4126c4bed83223b298103bb54127dd750d7fd42a51af463abd81ac5c8e1aaf5af3cb0b238dd63a3c91fb60ecf36cbeeab412bc55132e35e487"},
+    {"div", "-d38bdb629000dd74da18c3923", "c0e33cdd3341013b29f8428bb", NULL, "-1"},
+    {"mod", "-d38bdb629000dd74da18c3923", "c0e33cdd3341013b29f8428bb", NULL, "-12a89e855cbfdc39b02081068"},
+    {"pow", "3", "c8", NULL, "1fd5863c3eb0469ec21a937a76f3432ffd73d97e447606b683ecf6f6e4a7ae225bfaff1eaaf8b0a1"},
+    {"pow", "-2", "3f", NULL, "-8000000000000000"},
+    {"pow", "-7", "1f", NULL, "-82823c992d2be80fcb9ab7"},
+    {"pow", "1234567", "28", NULL, "aeb3a9aa1a0440469217c8dfbcbd97357f182d5812f15213977f99b2bd72f416cf22cdd641cd2ce05243e0d0d506f0e74688305e2dc35c7504a8854ea3967afe57ab264cb9549de17cdc7a630246814c86831f28164d3eeae4cbcc062952fa8d44bfac494ef42ae23f79594b00d7908f0a86f6e447c0c592c1"},
+    {"pow", "1", "400000000000000000", NULL, "1"},
+    {"powmod", "2", "7ffffffffffffffffffffffffffffffe", "7fffffffffffffffffffffffffffffff", "1"},
+    {"powmod", "7616361a00350c8", "aa87582525b5eb2d", "e2e052f605de7ee5", "e0dc8b27cbdc9284"},
+    {"powmod", "2e62d5aba373f85cd3a270cba9ada1e98a0206fedaa52fefa0c6b7b8d86f5493", "4e69790c9d7d5d67073abb64838593124489e58aea5e402bf19666a9be0b5969", "64f9ad0980ec470a34f424ad38fae396f3b21e1db11baf258918c625f4d0e2b3", "d89c31063af8e949122dbfebdf4c85e402ed41767fbfc9fb71711d300c2d329"},
+    {"powmod", "1a426e65c5d124342866bd36c7a8d966b9c93553adeb306d270dafeb268d0fb492fa0ccb085c1d26e228aa78142cc44d7629e7a516ffd5ecef40074a2e9d0e88173bb00f6faff63491357e2e341cc4915834fc093ad7f092c2df09cbf2ba44b5b882875a1e16fd65b0cd04fac2097368b057bf469ce7bf8dee00cae42f938be3", "e03699fc8912db3e2bedc576940816262364d10f3974294366c689914832344d391fffa314a29975802117904570ecd6edbd7045fce773670ed0e4abe33d9265a885ecf318a8a5e985f7dbc621c8c3b9c64ea8a1f6fdeb9424feeb568f4ead6672e614edd687374ae9f22a51d7cf6495ab59472c0bbc7b10ae96d796ae0bd75", "89bee77527c4bb5518db6dd3f40fbd36a49a815bd057c647a74843b9ff57a7264969295abafda7545fb2709aee68356e1788a78805c0125c308b1ce31bd8375c2c3a5d69e80edb49b7f9b7fdbf814cee75f25f4bb6d4407a22ff9bbb596dc9637b2db27a949d657378b5fc6d37fa5c9ef86da62e82bd0e2ecddc5409cc5a16f3", "3e3cc358b0415600fece79c16aed5fc808aa1b002eab2d7bce1caa950225664b35eb3bfc25897d96decbfb6f0cab0f27d35cb5caaf97ae7c7618b466b56c9e5729f057d958dc0ee8979ceffeb746afd76481c3ee9b75931f53248c3969a50e769657a9caa62f39bf55823f7f4661222427dc8a39ec9819508b51815adbfc801"},
+    {"powmod", "ae0d8590e3c7f45a0b3bf9b75c40ba7e10538faf195a8fd0a002e0a5b32f3a56f843acf25416027e34cd21ce1840fb591110dd4336d2559363b3ea890c1d06aa67e28b4d847a737a5e539d1ab24d7df43a55098534c13834779c501635479a759e839c2a45b84bb31b3dd57e175c4fb11f1a2cb73d08fc25d10c056edb57672fba5ed6c438da91875b360f5c60831ff767f1e60cd78903291f4127675fec8c8c4d30735f16d9e3d1f1389c679bb2fbd85b50a1371a11bddd551f4c52c1de401f1ecab3618e68180eb34a4796d3f5302ccee64776c83c0b4b5a9ad1f93fc8463f5de17df57d5a608abf22d904685292903b17ffcd0275ded7412ad32c8711168f85ef6d44823a96ce", "bc48e9351e43f6e69e1bbd083631b75334b287c2f8ecf67c1229d6906c06e18f650ff2fed9d2ae93ace7e9f7d1bf20cad5f155a9811779d49c2a7d2524210ad09e21fccd7b869787657bf54510c6b3c889a8bd5e9d591bb899693cefc2c5a27ee33725380e119cef49caa3fdef1552c2e588fbf23469be46d710c637ba33c619c698f72a594715ad20ee9d7cba59c9c00c349f107a48859dfeaeb5536b481032eac1beb98654a82669eca0531d4faf23e41e9f59f447677bb7bc66c90111a27e41c3d87053756d6b0a6faabd5727e2e1d0a65a0de60e7a2346836491fb00ae5a0ae699c6672c93d179544a249ee6ec69186a102d91e3f000222a971cddca02beec87438537c8eb5e", "b9911b6cef2a2724a757bf3a9ca4a7aff95b20196b8d4551954100760a24e793e44340b520c50be8cbb973d3b8b08b44c87c491d1d811a13c1e2f671fc650771dda0b628ff0d87d629887cd1c9af33b2c4e33ad25c9f8e7e5629c91e9ea941ca584fde14e05850764f79e555900acc855ba126fe79822550c85473ef8314c382e8a7f5453d706b9e36d240d14593bd19d6078ff2e22505a233998c1475473c71272f4d1f231087e01ab6f6b1d379f5c10a30d84d9539ced22adfbd0cce986860cc29cdb79a4d40feb7b59b7d1327102dba3b0c49b83ff7831181b9fa2dd81680169e7b102f4306de45b9f86a56caabfc7c3c532c7261291037390bef0e1a9d95306bd9d836f3d10f", "92b1467e4e438c9d81ea5ad000049314bb011762fe5a3dd2575e0f257ed05e7616c8eb2c34d509d286ff6ba7a1b4693864a059b5f7b9d1a532408d00a541382856dce9eab36dbe6207e79da93008fa6d3051a03284ad64ad1fe32cb3a82b22c8cb083e6338b1d8fab813afb79d655442424890a6821258a9641fad41482b3482601a8892ab33c8ea7ba6b3fd673f0c65e199eb078406783cb8ab481e39db06a3cd8eb7872c18eb6e03be5ebf834d11b49367bcb8640a4e26613bcaedc239536bf34e95606cd09d15225e01c552734c3337c3c4ff82193676138406ce709eb29d7cf7c175f55168307b4477a8405c85d259461098da9bcc03e6399392c8db8fcbec079d190a5ab345"},
+    {"mulmod", "ae0d8590e3c7f45a0b3bf9b75c40ba7e10538faf195a8fd0a002e0a5b32f3a56f843acf25416027e34cd21ce1840fb591110dd4336d2559363b3ea890c1d06aa67e28b4d847a737a5e539d1ab24d7df43a55098534c13834779c501635479a759e839c2a45b84bb31b3dd57e175c4fb11f1a2cb73d08fc25d10c056edb57672fba5ed6c438da91875b360f5c60831ff767f1e60cd78903291f4127675fec8c8c4d30735f16d9e3d1f1389c679bb2fbd85b50a1371a11bddd551f4c52c1de401f1ecab3618e68180eb34a4796d3f5302ccee64776c83c0b4b5a9ad1f93fc8463f5de17df57d5a608abf22d904685292903b17ffcd0275ded7412ad32c8711168f85ef6d44823a96ce", "a7b80e7b4870f3b89f2913d5a44a1d1074cc86038aca7d0dbafde52a4ff3fb8e6b1941863710e4c660987aca2bac085c62fe0e00d209e31537ed2edded4335db200e808bb428c9e4d68398ada25d5f6901ebf0c2aca817dfb1fccdd7a18f6dc982c71e2b4cc2ef297c769d2a3cc90ce88b5608466e0ef97fba00c360048790396f4e0c0857e96c840e2d8dfb9f6442682be296057fca6b6efd88f151f66499b5399027936ff019992e576cde8f5e4c249601198733483de95a9d049bc42034b1afe8c9a59621ee3f66f2134439149b80d63938affa09583da9ee9a7c5116dca040371c89f854783dc8542af89f993f3d8ff2fbc9ad46d20c7248cd27f396fd6f103c2eabe32f3543", "b9911b6cef2a2724a757bf3a9ca4a7aff95b20196b8d4551954100760a24e793e44340b520c50be8cbb973d3b8b08b44c87c491d1d811a13c1e2f671fc650771dda0b628ff0d87d629887cd1c9af33b2c4e33ad25c9f8e7e5629c91e9ea941ca584fde14e05850764f79e555900acc855ba126fe79822550c85473ef8314c382e8a7f5453d706b9e36d240d14593bd19d6078ff2e22505a233998c1475473c71272f4d1f231087e01ab6f6b1d379f5c10a30d84d9539ced22adfbd0cce986860cc29cdb79a4d40feb7b59b7d1327102dba3b0c49b83ff7831181b9fa2dd81680169e7b102f4306de45b9f86a56caabfc7c3c532c7261291037390bef0e1a9d95306bd9d836f3d10f", "65dee7ef3062e95a39b89624a69c037362656fb09b0adafafe61838c9fe3aa3b4a0fee0d81ba7ed8464cd3c0c87060bc37caca31bb90073f5333c4b2b85732f75e703b444d8334ba62aaa9ed51b542c85912c3a7a1b9eaef772a3bb540f3ea59eb26e3086677b58477d4b9e262c5f02b3d91c00f6fba61453337b7ccbc723b0b049d2b31454c7c07326e09fb8ece6444a2b1334ac1c2a144ebce52c3a6559ca483c1e691b8f64c6c8e9f25abddf40e27c5402a207464589c16a89245c788c9de59157108816a72fb92a6dc7faa62d24ebfa49304aceffc2ea8087086ac7267ef4556a4470d5d9dc9dd9898d84224e3f4d0ff18d6370b10ebbb55583e70c1d077cde7ba6511a71a83"},
+    {"sqrmod", "ae0d8590e3c7f45a0b3bf9b75c40ba7e10538faf195a8fd0a002e0a5b32f3a56f843acf25416027e34cd21ce1840fb591110dd4336d2559363b3ea890c1d06aa67e28b4d847a737a5e539d1ab24d7df43a55098534c13834779c501635479a759e839c2a45b84bb31b3dd57e175c4fb11f1a2cb73d08fc25d10c056edb57672fba5ed6c438da91875b360f5c60831ff767f1e60cd78903291f4127675fec8c8c4d30735f16d9e3d1f1389c679bb2fbd85b50a1371a11bddd551f4c52c1de401f1ecab3618e68180eb34a4796d3f5302ccee64776c83c0b4b5a9ad1f93fc8463f5de17df57d5a608abf22d904685292903b17ffcd0275ded7412ad32c8711168f85ef6d44823a96ce", NULL, "b9911b6cef2a2724a757bf3a9ca4a7aff95b20196b8d4551954100760a24e793e44340b520c50be8cbb973d3b8b08b44c87c491d1d811a13c1e2f671fc650771dda0b628ff0d87d629887cd1c9af33b2c4e33ad25c9f8e7e5629c91e9ea941ca584fde14e05850764f79e555900acc855ba126fe79822550c85473ef8314c382e8a7f5453d706b9e36d240d14593bd19d6078ff2e22505a233998c1475473c71272f4d1f231087e01ab6f6b1d379f5c10a30d84d9539ced22adfbd0cce986860cc29cdb79a4d40feb7b59b7d1327102dba3b0c49b83ff7831181b9fa2dd81680169e7b102f4306de45b9f86a56caabfc7c3c532c7261291037390bef0e1a9d95306bd9d836f3d10f", "a6bc362c95450f5f8398147aecdafa768336c3f2e982580d3a22303e7384fb2cd0199820a6e1d9e2cf8f82616d50d78efa2a2e00c66f7545b6f90284569bf9479cee7598dcb9beb392f129b98faf55f9e39d6b740cbf2841f4dfee5e881dd218d46fafd5fa7fb0f13b20dccc09df94885a6c05db9dbbd385a765c09869990ec6f7d1cb655dec24dbac09415dc8c2c9a48c71eb949c61c1d53c3e09b645acc6d3048e9e6a01928c7eed561b4c680547302a17bc929e5e272c6dadb555fc0dae14330d41effdcacade5a6ba9cb7959c20bb50617c8b4fe9a656f1e6f788acd5d9c41cd3134f5035628e7f816008b7ba48c0f988937edf183ec4278896292cdb72714ebf75b51a9c803"},
+    {"powmod", "92e04bb55760889a8d65cad731280b0da0595fd3904f29e6be438b7b2ecf36b037d12d4e3b44d4810b88b54983969169351a55cce80028b81255468fbcfe94645572c68700bd1f1550be1c3ab6978cb1b6dac33c93c8889de379d5bd639e1e31413210c2ecb9daa1b8fb821af94612bec61b54437c149bb71bc87b064a96a6447d83e70adbbd7696d0ffb7753fc2f5e0ec995b1e96435c1c3214a41d542957474ee989df93c4bfeffab96e74761b742f13c945fe656ead231b26d1b5d44f5e331432c9f3a782282774605df9a62651bee445fa53f516eade6291d3bf71225c69acf3a4ae5aa96df1ab7c35a08b51a9a2a804d60d15f04cac24ea56603bfc1ae84fd1a72c188d5cb0f23494ef57d435053b1085", "3d37a404224d6952", "cf08585a83801e3f9af0a298f7b8445486a72035d6bfa2b60641b19e7d4df97cc731ed9797db8392ddbb46e5520f347109ee1fd845fc7b7eaad2adc0f053bac9386a5ad4b6971ab830744374a2f28f4641eddea559b89ee708298cd655a28203f74affdcc8d45811ea9b025d385746be98c3bff5c6074c6793c04c1f3f1ee9be42a1b35a380a8914f533a8167eab9ada2c4a8c9eca0bd85a82e756ab01786d493162e698e4da8a99970d9930a1ddbc8d6c8922850935784a72c98bb5563b1863a1f962211bc1c54dd4d18156052a59d8019e9208a5d31200ac40b255ddb974e84fd95e9d3635a60370f2d1321841f47549d9c00814e74e135901ffc1b95bd6d683abe6afdfe039454e5c896a71bd1721c0c1c3", "cd5c40b5e192ff5b78b8d0f4d6f8f436deffd4b7bf6e1dc5f702eb5a228126e9d9ae439f93a1bcc58f7d03a041f9b57dbc84bcde561a4aa1f230e409e49ebb7829020e10d3058597a96c28713e1738a742dad5eaf6f3c36a174991bd0974913c5c0c04ac682b74b121d79f490682c524e0cd7d4af891dec9c5eea27dd150b0a2a831393ef32e7796726606b31fb986f5a47e4f8a7717aa0ac62097b5ce805a12fccd2b5716308dd232a59e4f3d913f2fc5f34dbb9f4a4ea1666b1a285d1d3e4852d538396f8ca7ec1e95502058e585d11dcd13db07314af7144014fe56ed799e9373d7ced01d8dc306403f83578ddc370c4af6ae42823f86bbd074220ff7ebf001ab74f7be3352ec04742711a9ab0d28c50add"},
+    {"mulmod", "92e04bb55760889a8d65cad731280b0da0595fd3904f29e6be438b7b2ecf36b037d12d4e3b44d4810b88b54983969169351a55cce80028b81255468fbcfe94645572c68700bd1f1550be1c3ab6978cb1b6dac33c93c8889de379d5bd639e1e31413210c2ecb9daa1b8fb821af94612bec61b54437c149bb71bc87b064a96a6447d83e70adbbd7696d0ffb7753fc2f5e0ec995b1e96435c1c3214a41d542957474ee989df93c4bfeffab96e74761b742f13c945fe656ead231b26d1b5d44f5e331432c9f3a782282774605df9a62651bee445fa53f516eade6291d3bf71225c69acf3a4ae5aa96df1ab7c35a08b51a9a2a804d60d15f04cac24ea56603bfc1ae84fd1a72c188d5cb0f23494ef57d435053b1085", "38787dc96d736b4c423976266b52b54cf098867eaf26a818dbf33b4069309e3f886da1cbb7e8017d1c59287c9faae006f22c9e3f565d29ff603f9cb6c0abd686cd6d3d29c240de81dc34ffe70622a3ef667b6988bafa0a1c365acc656b34e5cc1ff20080cad9d402862995dfbd88011e4af39a10385a18978a4e19c702c1372a78a6f51595b64750ebb44763d54a5d3a174f60348b38c226dcd7e43d614de4734632c28c2d293cc580a94d00ec573b46452e41ec1569408df8be6bbd75fc0773d44b1a71c8c1002722f113582094527a5ede2053008ce2e7996ca1ed57c7ea83c4d5ef1863be4481f03d577a5cf32688ed27c53a16e01a3ad94c889096bfa7446576287f6bd6ccf5b25c39a2fb91ee330ba8b", "cf08585a83801e3f9af0a298f7b8445486a72035d6bfa2b60641b19e7d4df97cc731ed9797db8392ddbb46e5520f347109ee1fd845fc7b7eaad2adc0f053bac9386a5ad4b6971ab830744374a2f28f4641eddea559b89ee708298cd655a28203f74affdcc8d45811ea9b025d385746be98c3bff5c6074c6793c04c1f3f1ee9be42a1b35a380a8914f533a8167eab9ada2c4a8c9eca0bd85a82e756ab01786d493162e698e4da8a99970d9930a1ddbc8d6c8922850935784a72c98bb5563b1863a1f962211bc1c54dd4d18156052a59d8019e9208a5d31200ac40b255ddb974e84fd95e9d3635a60370f2d1321841f47549d9c00814e74e135901ffc1b95bd6d683abe6afdfe039454e5c896a71bd1721c0c1c3", "15f4bf5b15b6756b39be54e43a453e843d26b3dacff822d9203c43fcf6689cb2db4e11448dacf1c3a9c65fb6c81c725cfe02687cfdc1b85145fe3cacfcc1fc0922720aff27412fa87a90f70f77173971d786e68262edc842741ae1be964c9ca88b2a26b6a658b416589d1f6c3269f6e894c1616763456f5ee93d11aa019beb0a4a573cfb850cf4737f7c0e3f8b14464eed9dd9e517dd9df024df8be3c9bcaf0d16aa21eeba277cff42169a2b408fc8c03508d3686e5282638ee57a05e1c48dcccdd5b00637cb63b64337ab026321131dd3065764e2a195729d4eac7de806acb5b9de2c27ad79f4d1f45ea6613f966a8e6717de56c370b7f0d2e7321e8e509fdcb5a8379233155255e79927ebebeab9345d604"},
+    {"sqrmod", "92e04bb55760889a8d65cad731280b0da0595fd3904f29e6be438b7b2ecf36b037d12d4e3b44d4810b88b54983969169351a55cce80028b81255468fbcfe94645572c68700bd1f1550be1c3ab6978cb1b6dac33c93c8889de379d5bd639e1e31413210c2ecb9daa1b8fb821af94612bec61b54437c149bb71bc87b064a96a6447d83e70adbbd7696d0ffb7753fc2f5e0ec995b1e96435c1c3214a41d542957474ee989df93c4bfeffab96e74761b742f13c945fe656ead231b26d1b5d44f5e331432c9f3a782282774605df9a62651bee445fa53f516eade6291d3bf71225c69acf3a4ae5aa96df1ab7c35a08b51a9a2a804d60d15f04cac24ea56603bfc1ae84fd1a72c188d5cb0f23494ef57d435053b1085", NULL, "cf08585a83801e3f9af0a298f7b8445486a72035d6bfa2b60641b19e7d4df97cc731ed9797db8392ddbb46e5520f347109ee1fd845fc7b7eaad2adc0f053bac9386a5ad4b6971ab830744374a2f28f4641eddea559b89ee708298cd655a28203f74affdcc8d45811ea9b025d385746be98c3bff5c6074c6793c04c1f3f1ee9be42a1b35a380a8914f533a8167eab9ada2c4a8c9eca0bd85a82e756ab01786d493162e698e4da8a99970d9930a1ddbc8d6c8922850935784a72c98bb5563b1863a1f962211bc1c54dd4d18156052a59d8019e9208a5d31200ac40b255ddb974e84fd95e9d3635a60370f2d1321841f47549d9c00814e74e135901ffc1b95bd6d683abe6afdfe039454e5c896a71bd1721c0c1c3", "8aee2c6b1b2bed64588db3ae44c2e677edc22b218fa8249a599c4e7c5161f71fd1c295a09bc3ccebfeb7f68200af819ae2e0bbd00903c5270537aa7b557f9a3817730091db6ac44b664136cb8f5ed89f5b3960592724e97bb3b485e350c451ec3b639c18ade9b3d7b23e979b0f3ad49995215daad893a0c981720165f816398b354d6fd14f7c1bc9c9e990364cbb4507f7ee623855d79b21b8f5fe25c5d690297ea7c5d7c9daa567b3b7d97683e9cf079903e3350c93ec7fb907c0af0748681bf103185c58d1054f433b9b3844a04fcd5c5de1ba91ff9c86427a9bf0d3ede65ea9536943da5d3d6fbc8c3b4fc9163580628f200fbbce729e0faf8168255a261711e46fee58f1d2cd05844b63b5d738e9efc76b"},
+    {"powmod", "d6b78034171dda3fd6af41147ba382c9947766f5b3077633a460583ac8a764a0a82fbf367b0fea468d2844da2b8ac6255f6d00c97fd721feb19694e35c2a0ff247e36bc34f046b02d5b2b4b0dcbe1bc2b8accbda838af18d9b951fb4c7a60f9cb4a32a9d270381673e935151912bb1713d34d8f9c6b7c37ca81f906c152949f1dbeb74ff1f8dbf86e95ae00d7e20b476071920562d256655cc7e13841110d8dd5576c68d28123266fd0f3069645bd7a7811b8ebf7709b6ae8784d4ef5e6f43358122e64e3e333271cb394f4fc74b69bb4b67617cd9d82781aa2ca2dd2985b4f001806948508931f66b3371bcb30ba19fb08ba81dbbcf1f2d0a62a62f0ad372d7c81f1030526c8cae12f01d61d6f67d8f5bfae2cce3e798e9b77d1a69ae38cd5e388b77dfaae24a4ac9fed9adda003c9bc6976e98496fecfa48ae47e014613f8a62a3f3d65e13db1157f703d4917605a6b62ec7456673b773613878c087ffe1d62d7e23a5517e967144264c3c4402705d2140db7283074f", "141b0c19b548f7fad70f860c5992ff006b015367b80e4b60d9563a159760c9d7a4cf35d3865fc02ef6dff669889070d9213a18f6c60e13f708e30696d928b35fe738ef3e64a3c7f084b7c01fe04a5ae4f1d213214d26dd18153cefed0d07ea509c0f08b589457210eb2f6662cf78af28e2f9b091162c4bef6bd838959c59ece63e63bc76faae50cf6cb489868ce1ee1dfd33457c3ab603d97b3b12db8fbb2702f11812841333f2c0a7e298927147d16530c33a6477c880b069cd48fd22ad65519f61de12bc1972b81a76f7ffbf41bfc4e467074cd79ebc85d456065ad3f785b4422d6f266ec2d46f6e077e931785bd48fa15f4cf21d55aafbf707e42cbbff2d41b7dc1103774b6ed04afa3dcfa7089fc4aa75e2a97513e7da841841e8b0a1292de81d454e30a423dc934182a33fb4aed74bb68e5c4474c4e9f67c25d26cce4a9d0617ea802b61927afe6278a56e2771cfdb5056a0ec694d2b0fed1b5fe6723d746fbd4000f88c1b78082ef8d621f4754eff568ff8875c48", "1b45f210f6fd5a869f1b7b6c8e276999797fee3ac75ddddb9bea67d4c50247ca4aa76f81ac199f2673f4d327de09a8e942b9023d792ed5ec09c31ef296fe7de1de9f746adb38290aac8e940f5d8cfce3003defdc1d2f7c7cc942da228aea046f5e7dc0ad308eab97252e39333f809fa3de1a9293b7bca3ce441863bc60ec36d70d334140aa636e18d6b73d8cbaef2c235b5199cdada4fd43aa28a05939a2e14467e51e59e89c41d6309dd3850f46adb54b7b3fcbcf435b5c6fc82eb157983a1e5e3ec7ba6230fadd00ca7b4c15841f410ef6d0f46a34ff085cb9f56c1324108662f925c47f38f6bc2992829112e26afb4f4d607ee111d269e210b2895d34bff6da8b3cc827474a2cf37996d5623161d6f649e592cdf40b92fed6e92c48b55a00accb764c1b5167e0a843f4b13e8dad9ff651678cb338e87b0d8a42181dbf6f188d9df13d49ab8b209cdd7e77da2d51469a392e09eb05a8e892ef0f82a52004839a1d2fc1d7b6c707b817d9a216b8e98eae5beac73850d4f", "cd9cfabd52b525c6c9819b55696dcd043019ad4f9d15353824baff8d640144260c41a468bf7ff71e9201d9dece575a388afc17ffc81498fee85399d95240a83710571fb5cc056d0c0db158a49b09419677c8123946da94de128719006a1bb7cf157ea10a6fff705d38e7e3a4bcb401d724e687b1a59f387742c5e68124d30a71978cdda04888d295dca6c251a1ee7039444959d35c72da828fca39a9bafa322ee73e3ece5873938a5f6f92c2c02427c51c757e5cfbd2e86b7310d4739f2c2027ad7e4cd91a4efaa8ebc08730bec5755f2eb71ed312403ccc4126bfdd10481e9396ce6c466f561b5d0d642ba878eccfb1c64145f7d44ab2e312cc8cd9e7f2f2c95d38bdf6dc84a6b33290116fcb1fec4c5f9ee297cfa4200dffd7a70a2d425ed75d77adfc6757b7bf24d1c9a6d0e513f5202691461bc189f0564cfa6f8cec4bd048ecd424df77cdc32a0f64b55f9f606695efb63154a490fdc7f20481426d62a94c5797cf6f8d2ab52b795720c5edecc38bdcf4b0ee4ba8"},
+    {"mulmod", "d6b78034171dda3fd6af41147ba382c9947766f5b3077633a460583ac8a764a0a82fbf367b0fea468d2844da2b8ac6255f6d00c97fd721feb19694e35c2a0ff247e36bc34f046b02d5b2b4b0dcbe1bc2b8accbda838af18d9b951fb4c7a60f9cb4a32a9d270381673e935151912bb1713d34d8f9c6b7c37ca81f906c152949f1dbeb74ff1f8dbf86e95ae00d7e20b476071920562d256655cc7e13841110d8dd5576c68d28123266fd0f3069645bd7a7811b8ebf7709b6ae8784d4ef5e6f43358122e64e3e333271cb394f4fc74b69bb4b67617cd9d82781aa2ca2dd2985b4f001806948508931f66b3371bcb30ba19fb08ba81dbbcf1f2d0a62a62f0ad372d7c81f1030526c8cae12f01d61d6f67d8f5bfae2cce3e798e9b77d1a69ae38cd5e388b77dfaae24a4ac9fed9adda003c9bc6976e98496fecfa48ae47e014613f8a62a3f3d65e13db1157f703d4917605a6b62ec7456673b773613878c087ffe1d62d7e23a5517e967144264c3c4402705d2140db7283074f", "fb06f2f89fc267bc4731a5dcbdf65ee6ec22f9f30f6bf875868031e842217af485aecb8f5ffd0b7cb9e75abf0ea4a456e3f10c51523fe8c097b2d1e9ada7a46cc8c300b588d714756e9c67006f9bf793ab97603e793eb55b5e3bd2374ed27cf277b0a5a63a9337cb6d086218c4381f7615b62b3871b9422dd2e9ad1d282f32835c4e718272b9280e28a66ec3c44d3e35f53a03adee29eb896c693c28a70c5508118e9e81578fcab1310be3a1f0fbb79c9071af8a8f92655acd51cbe44de990a70bbb9274f78a195c0df962c9be6185550f3e7faceb06b585d492959a4ca4182eda58381f71e409ef305331f26377196513822a9d8ecc832b7683cef57a10822ddb80d13e0ded3c47cb9b95f1e0128bb2f2761c58243bec4f1ac7f40e1fd789266189a5235e4a11226de9c012555fe9a339fe466e6ba83c23608c1985f6bc3bd9b9a18e2eee283d43ef2e36b213bb6c089efc57638b62d131bab34e538e9c97371fa939673ad8d360caea45637253bcdeb7db1f945c59ba", "1b45f210f6fd5a869f1b7b6c8e276999797fee3ac75ddddb9bea67d4c50247ca4aa76f81ac199f2673f4d327de09a8e942b9023d792ed5ec09c31ef296fe7de1de9f746adb38290aac8e940f5d8cfce3003defdc1d2f7c7cc942da228aea046f5e7dc0ad308eab97252e39333f809fa3de1a9293b7bca3ce441863bc60ec36d70d334140aa636e18d6b73d8cbaef2c235b5199cdada4fd43aa28a05939a2e14467e51e59e89c41d6309dd3850f46adb54b7b3fcbcf435b5c6fc82eb157983a1e5e3ec7ba6230fadd00ca7b4c15841f410ef6d0f46a34ff085cb9f56c1324108662f925c47f38f6bc2992829112e26afb4f4d607ee111d269e210b2895d34bff6da8b3cc827474a2cf37996d5623161d6f649e592cdf40b92fed6e92c48b55a00accb764c1b5167e0a843f4b13e8dad9ff651678cb338e87b0d8a42181dbf6f188d9df13d49ab8b209cdd7e77da2d51469a392e09eb05a8e892ef0f82a52004839a1d2fc1d7b6c707b817d9a216b8e98eae5beac73850d4f", "173def21b0bad66775c1c2c74b561fd32c56a999e81c73b06f5d72bf7f980217d3e27ffbc5422a3a168f6f2b0e6fea96aed725ed3089bab68412c20db84c84991b509c18cc198be42549b0e123daed5c6c96f77e4dfd5a5479a8ee6bd9dbcb22ad7ade2ece7d1a2439b4b7842e4124a20048a576af8260196e08bdb189f1c2bf67ddfcde3cb41c75d9da21a43843bcbe240e969bbd7d874fc939d2ca5bad5ad5a2e3fd94f0b16521912d89be6e1ead608d7bc6644390d73412d6d9933a4589bb64ef04f625d7a9cbbf5b656f4f98ff3c482137a91eacd0753e7f72a33582835e6c651e1fa0605e0c415162913f95b772388e8ec102804f0e7e6746a22c2010937ca4d3869b1f6ddb298283264619e0506334ebbcbc08815bf9e4798b9813ddf1da8a0a6f6bc3213f1e71a812f4681b7e7c61828ce4fb1505705aa208dcb79a10d678db372914dabc3238ae715d29c833ca1709b789e97dfb7d397e03f5d8561d4acbe776bb8fe45656221e494658d097e5c795bc89b9afa"},
+    {"sqrmod", "d6b78034171dda3fd6af41147ba382c9947766f5b3077633a460583ac8a764a0a82fbf367b0fea468d2844da2b8ac6255f6d00c97fd721feb19694e35c2a0ff247e36bc34f046b02d5b2b4b0dcbe1bc2b8accbda838af18d9b951fb4c7a60f9cb4a32a9d270381673e935151912bb1713d34d8f9c6b7c37ca81f906c152949f1dbeb74ff1f8dbf86e95ae00d7e20b476071920562d256655cc7e13841110d8dd5576c68d28123266fd0f3069645bd7a7811b8ebf7709b6ae8784d4ef5e6f43358122e64e3e333271cb394f4fc74b69bb4b67617cd9d82781aa2ca2dd2985b4f001806948508931f66b3371bcb30ba19fb08ba81dbbcf1f2d0a62a62f0ad372d7c81f1030526c8cae12f01d61d6f67d8f5bfae2cce3e798e9b77d1a69ae38cd5e388b77dfaae24a4ac9fed9adda003c9bc6976e98496fecfa48ae47e014613f8a62a3f3d65e13db1157f703d4917605a6b62ec7456673b773613878c087ffe1d62d7e23a5517e967144264c3c4402705d2140db7283074f", NULL, "1b45f210f6fd5a869f1b7b6c8e276999797fee3ac75ddddb9bea67d4c50247ca4aa76f81ac199f2673f4d327de09a8e942b9023d792ed5ec09c31ef296fe7de1de9f746adb38290aac8e940f5d8cfce3003defdc1d2f7c7cc942da228aea046f5e7dc0ad308eab97252e39333f809fa3de1a9293b7bca3ce441863bc60ec36d70d334140aa636e18d6b73d8cbaef2c235b5199cdada4fd43aa28a05939a2e14467e51e59e89c41d6309dd3850f46adb54b7b3fcbcf435b5c6fc82eb157983a1e5e3ec7ba6230fadd00ca7b4c15841f410ef6d0f46a34ff085cb9f56c1324108662f925c47f38f6bc2992829112e26afb4f4d607ee111d269e210b2895d34bff6da8b3cc827474a2cf37996d5623161d6f649e592cdf40b92fed6e92c48b55a00accb764c1b5167e0a843f4b13e8dad9ff651678cb338e87b0d8a42181dbf6f188d9df13d49ab8b209cdd7e77da2d51469a392e09eb05a8e892ef0f82a52004839a1d2fc1d7b6c707b817d9a216b8e98eae5beac73850d4f", "4a11c372aaa751e4a4c48f980698e2c2208d9f89e2c8250aa2f08c3fce6e459690c603242a67590fa998d9662dd14a64aa1de3d4e467bf4ae867eda5fd9001bf8917852a9d5959fb80a9fd98d667d20548299905f26d5bf6a0723deebac773785f150875bcd7cff177e657a98cfe585b511f261934cce6d1edcc9959dea6d825d92e22609839019dca21eb1453da4f3d1717393a14d33f550296fde3453c672a3bb2b475a88c53fac8b4d9a47a4057f31df04244d4283fdb45c4621bffd4237424d5c26fd662df4ff3a09acd25cde89cb17d1814f815ddc93fe8ded8eaf8e81ed42071949fe333cb6286eacb5efe1c43e8361a14af5d9a3cc0b925d9ea5b382a51c6ea0064042b0eb8c43ff30dddeb869740a578e0185e85d650b9e98fb93c644b175d99eb0b895b0dd3bd70cf2524c252d0dde0cac5dc2c114f90e1d582bc6aee4eb2fa8807ca179d405cfecfafb5d890954b4a7f07d963a049d27dfdfb557e0282b6098db3d6ed56427c5a3e9561e49b3fcf687e93da"},
+    {"mulmod", "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe", "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe", "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffeffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff", "1"},
+    {"sqrmod", "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe", NULL, "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffeffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff", "1"},
+    {"powmod", "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe", "800000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001", "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffeffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff", "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe"},
+};
+
+void NOAHZK_test_add(const char* const op, const NOAHZK_variable_width_t* const a, const NOAHZK_variable_width_t* const b, const char* const expected){
+    const int sub = !strcmp(op, "sub");
+    NOAHZK_variable_width_t r = NOAHZK_variable_width_INITIALISER;
+    (sub? NOAHZK_variable_width_sub_and_resize: NOAHZK_variable_width_add_and_resize)(&r, a, b);
+    NOAHZK_test_check(op, "and_resize", &r, expected);
+    (sub? NOAHZK_variable_width_sub_and_resize_vartime: NOAHZK_variable_width_add_and_resize_vartime)(&r, a, b);
+    NOAHZK_test_check(op, "vartime", &r, expected);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+
+// a limb wider than both, so the sum can't wrap
+    NOAHZK_test_init(&r, NOAHZK_MAX(a->width, b->width) + 1);
+    (sub? NOAHZK_variable_width_sub: NOAHZK_variable_width_add)(&r, a, b);
+    NOAHZK_test_check(op, "constant-time", &r, expected);
+    NOAHZK_variable_width_add_or_sub(&r, a, b, sub);
+    NOAHZK_test_check(op, "add_or_sub", &r, expected);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+}
+
+void NOAHZK_test_add_constant(const char* const op, const NOAHZK_variable_width_t* const a, const char* const k_hex, const char* const expected){
+    const int sub = !strcmp(op, "subk");
+    const uint64_t k = strtoull(k_hex, NULL, 16);
+    NOAHZK_variable_width_t r = NOAHZK_variable_width_INITIALISER;
+    (sub? NOAHZK_variable_width_sub_and_resize_constant: NOAHZK_variable_width_add_and_resize_constant)(&r, a, k);
+    NOAHZK_test_check(op, "and_resize", &r, expected);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+
+// k may take up two limbs, & a limb more keeps the sign
+    NOAHZK_test_init(&r, NOAHZK_MAX(a->width, sizeof(k)/sizeof(NOAHZK_limb_t)) + 1);
+    (sub? NOAHZK_variable_width_sub_constant: NOAHZK_variable_width_add_constant)(&r, a, k);
+    NOAHZK_test_check(op, "constant-time", &r, expected);
+    NOAHZK_variable_width_add_or_sub_constant(&r, a, k, sub);
+    NOAHZK_test_check(op, "add_or_sub", &r, expected);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+}
+
+void NOAHZK_test_negate(const char* const op, const NOAHZK_variable_width_t* const a, const char* const expected){
+    const int negate = !strcmp(op, "neg");
+    NOAHZK_variable_width_t r = NOAHZK_variable_width_INITIALISER;
+// a limb wider than a, as negating its most negative value takes one more bit
+    NOAHZK_test_init(&r, a->width + 1);
+    (negate? NOAHZK_variable_width_negate: NOAHZK_variable_width_invert)(&r, a);
+    NOAHZK_test_check(op, "constant-time", &r, expected);
+
+    if(negate){
+        NOAHZK_variable_width_negate_conditionally(&r, a, 1);
+        NOAHZK_test_check(op, "conditionally", &r, expected);
+        NOAHZK_variable_width_abs(&r, a);
+        NOAHZK_test_check(op, "abs", &r, expected[0] == '-'? expected + 1: expected);
+    }
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+}
+
+// also goes through eq, select, min & max with the same pair; which of a & b is the smaller comes from the expected comparison
+void NOAHZK_test_cmp(const char* const op, const NOAHZK_variable_width_t* const a, const NOAHZK_variable_width_t* const b, const char* const a_hex, const char* const b_hex, const char* const expected){
+    const int lt = !strcmp(expected, "-1");
+    const NOAHZK_limb_t cmp = NOAHZK_variable_width_cmp(a, b);
+    NOAHZK_test_check_number(op, "cmp", cmp == NOAHZK_LIMB_MAX? -1: (long long)cmp, expected);
+    NOAHZK_test_check_number(op, "eq", NOAHZK_variable_width_eq(a, b), strcmp(expected, "0")? "0": "1");
+
+    NOAHZK_variable_width_t r = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_test_init(&r, NOAHZK_MAX(a->width, b->width));
+    NOAHZK_variable_width_select(&r, a, b, 0);
+    NOAHZK_test_check(op, "select 0", &r, a_hex);
+    NOAHZK_variable_width_select(&r, a, b, 1);
+    NOAHZK_test_check(op, "select 1", &r, b_hex);
+    NOAHZK_variable_width_min(&r, a, b);
+    NOAHZK_test_check(op, "min", &r, lt? a_hex: b_hex);
+    NOAHZK_variable_width_max(&r, a, b);
+    NOAHZK_test_check(op, "max", &r, lt? b_hex: a_hex);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+}
+
+// the signed width stays put as a is sign-extended, so it's checked again three limbs wider;
+// a nonnegative value is as wide unsigned, less the sign bit
+void NOAHZK_test_bitcnt(const char* const op, const NOAHZK_variable_width_t* const a, const char* const a_hex, const char* const expected){
+    NOAHZK_variable_width_t wide = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_test_init_hex(&wide, a->width + 3, a_hex);
+    NOAHZK_test_check_number(op, "signed", NOAHZK_variable_width_signed_bitcnt(a), expected);
+    NOAHZK_test_check_number(op, "signed vartime", NOAHZK_variable_width_signed_bitcnt_vartime(a), expected);
+    NOAHZK_test_check_number(op, "signed, wider", NOAHZK_variable_width_signed_bitcnt(&wide), expected);
+    NOAHZK_test_check_number(op, "signed cached", NOAHZK_variable_width_signed_bitcnt_cached(&wide), expected);
+    NOAHZK_test_check_number(op, "signed cached again", NOAHZK_variable_width_signed_bitcnt_cached(&wide), expected);
+
+    if(!a->sign){
+        const size_t bits = NOAHZK_variable_width_signed_bitcnt_vartime(a) - 1;
+        NOAHZK_test_expect(NOAHZK_variable_width_min_bitcnt(&wide) == bits, op, "unsigned, wider");
+        NOAHZK_test_expect(NOAHZK_variable_width_min_bitcnt_vartime(&wide) == bits, op, "unsigned vartime, wider");
+    }
+    NOAHZK_variable_width_destroy(&wide, NOAHZK_variable_width_keep_ptr);
+}
+
+// a dot product of three pairs against the same sum done a product at a time, then the empty sum & a sum of width-0 operands,
+// each into a dst that already holds something
+void NOAHZK_test_dot(void){
+    const char* const hex0[] = {"-34d52bc614bedce030297c5e538f12d92", "ffffffffffffffff", "-1"};
+    const char* const hex1[] = {"1be506564f3a160712456de76", "ffffffffffffffffffffffff", "7fffffffffffffffffffffffffffffff"};
+    NOAHZK_variable_width_t a[3], b[3], product = NOAHZK_variable_width_INITIALISER, sum = NOAHZK_variable_width_INITIALISER, r = NOAHZK_variable_width_INITIALISER;
+    const NOAHZK_variable_width_t* rs0[3], *rs1[3];
+
+    NOAHZK_variable_width_from_hex_and_resize(&sum, "0");
+    for(size_t t = 0; t < 3; t++){
+        a[t] = b[t] = (NOAHZK_variable_width_t)NOAHZK_variable_width_INITIALISER;
+        NOAHZK_variable_width_from_hex_and_resize(&a[t], hex0[t]);
+        NOAHZK_variable_width_from_hex_and_resize(&b[t], hex1[t]);
+        rs0[t] = &a[t];
+        rs1[t] = &b[t];
+        NOAHZK_variable_width_mul_and_resize(&product, &a[t], &b[t]);
+        NOAHZK_variable_width_add_and_resize(&sum, &sum, &product);
+    }
+    const size_t size = NOAHZK_variable_width_to_hex_size(&sum);
+    char* const expected = malloc(size);
+    NOAHZK_variable_width_to_hex(expected, size, &sum);
+
+    NOAHZK_variable_width_dot_and_resize(&r, rs0, rs1, 3);
+    NOAHZK_test_check("dot", "and_resize", &r, expected);
+    NOAHZK_variable_width_dot_and_resize(&r, rs0, rs1, 0);
+    NOAHZK_test_check("dot", "empty", &r, "0");
+
+    NOAHZK_variable_width_from_hex_and_resize(&r, "-5");
+    for(size_t t = 0; t < 3; t++) a[t].width = 0;
+    NOAHZK_variable_width_dot_and_resize(&r, rs0, rs1, 3);
+    NOAHZK_test_check("dot", "width-0 operands", &r, "0");
+
+    for(size_t t = 0; t < 3; t++){
+        NOAHZK_variable_width_destroy(&a[t], NOAHZK_variable_width_keep_ptr);
+        NOAHZK_variable_width_destroy(&b[t], NOAHZK_variable_width_keep_ptr);
+    }
+    NOAHZK_variable_width_destroy(&product, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&sum, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+    free(expected);
+}
+
+// the 64-bit helpers the limb versions are built from
+void NOAHZK_test_bitcnt_var(void){
+    const uint64_t values[] = {0, 1, 2, 3, 0xff, 0x100, 0xffffffff, 0x100000000, 0x8000000000000000, UINT64_MAX};
+    const size_t bitcnts[] = {0, 1, 2, 2, 8, 9, 32, 33, 64, 64}, ceil_log2s[] = {0, 0, 1, 2, 8, 8, 32, 32, 63, 64};
+
+    for(size_t i = 0; i < sizeof(values)/sizeof(values[0]); i++){
+        NOAHZK_test_expect(NOAHZK_min_bitcnt_var(values[i]) == bitcnts[i], "bitcnt", "min_bitcnt_var");
+        NOAHZK_test_expect(NOAHZK_ceil_log2_value(values[i]) == ceil_log2s[i], "bitcnt", "ceil_log2_value");
+        NOAHZK_test_expect(NOAHZK_variable_width_min_bitcnt_byte(&values[i], sizeof(values[i])) == bitcnts[i], "bitcnt", "min_bitcnt_byte");
+    }
+}
+
+void NOAHZK_test_mul(const char* const op, const NOAHZK_variable_width_t* const a, const NOAHZK_variable_width_t* const b, const char* const expected){
+    NOAHZK_variable_width_t r = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_variable_width_mul_and_resize(&r, a, b);
+    NOAHZK_test_check(op, "and_resize", &r, expected);
+    NOAHZK_variable_width_mul_and_resize_vartime(&r, a, b);
+    NOAHZK_test_check(op, "vartime", &r, expected);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+
+    NOAHZK_test_init(&r, a->width + b->width);
+    NOAHZK_variable_width_mul(&r, a, b);
+    NOAHZK_test_check(op, "constant-time", &r, expected);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+}
+
+// a^2 by each squaring form, & by the unsigned one too if a isn't negative
+void NOAHZK_test_square(const char* const op, const NOAHZK_variable_width_t* const a, const char* const expected){
+    NOAHZK_variable_width_t r = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_variable_width_square_and_resize(&r, a);
+    NOAHZK_test_check(op, "and_resize", &r, expected);
+    if(!a->sign){
+        NOAHZK_variable_width_square_and_resize_unsigned(&r, a);
+        NOAHZK_test_check(op, "unsigned", &r, expected);
+    }
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+
+// into 2*width limbs, once from a & once in place
+    NOAHZK_test_init(&r, 2*a->width);
+    NOAHZK_variable_width_square_primitive(&r, a, r.width);
+    NOAHZK_test_check(op, "primitive", &r, expected);
+    if(a->width) memcpy(r.arr, a->arr, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(a->width));
+    r.width = a->width;
+    r.sign = a->sign;
+    NOAHZK_variable_width_square_primitive(&r, &r, 2*a->width);
+    NOAHZK_test_check(op, "primitive in place", &r, expected);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+}
+
+void NOAHZK_test_divrem(const char* const op, const NOAHZK_variable_width_t* const a, const NOAHZK_variable_width_t* const b, const char* const expected){
+    const int quotient = !strcmp(op, "div");
+    NOAHZK_variable_width_t q = NOAHZK_variable_width_INITIALISER, r = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_variable_width_divrem_and_resize(&q, &r, a, b);
+    NOAHZK_test_check(op, "and_resize", quotient? &q: &r, expected);
+    NOAHZK_variable_width_destroy(&q, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+
+    NOAHZK_test_init(&q, a->width);
+    NOAHZK_test_init(&r, b->width);
+    NOAHZK_variable_width_divrem(&q, &r, a, b);
+    NOAHZK_test_check(op, "constant-time", quotient? &q: &r, expected);
+    NOAHZK_variable_width_destroy(&q, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+}
+
+void NOAHZK_test_pow(const char* const op, const NOAHZK_variable_width_t* const a, const NOAHZK_variable_width_t* const b, const char* const expected){
+    NOAHZK_variable_width_t r = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_variable_width_pow_and_resize_vartime(&r, a, b);
+    NOAHZK_test_check(op, "and_resize_vartime", &r, expected);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+
+// one more limb than the power takes up, so it keeps its sign
+    NOAHZK_test_init(&r, NOAHZK_variable_width_pow_width_vartime(a, b) + 1);
+    NOAHZK_variable_width_pow(&r, a, b);
+    NOAHZK_test_check(op, "constant-time", &r, expected);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+}
+
+void NOAHZK_test_powmod(const char* const op, const NOAHZK_variable_width_t* const a, const NOAHZK_variable_width_t* const b, const NOAHZK_variable_width_t* const n, const char* const expected){
+    NOAHZK_montgomery_ctx_t ctx;
+    if(!NOAHZK_montgomery_ctx_init(&ctx, n)){
+        NOAHZK_test_checks++;
+        NOAHZK_test_failures++;
+        printf("FAIL %s: no Montgomery context for the modulus\n", op);
+        return;
+    }
+
+    NOAHZK_variable_width_t r = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_montgomery_ctx_init_element(&ctx, &r);
+    NOAHZK_variable_width_pow_mod(&r, a, b, &ctx);
+    NOAHZK_test_check(op, "fixed window", &r, expected);
+    NOAHZK_variable_width_pow_mod_ladder(&r, a, b, &ctx);
+    NOAHZK_test_check(op, "ladder", &r, expected);
+    NOAHZK_variable_width_pow_mod_vartime(&r, a, b, &ctx);
+    NOAHZK_test_check(op, "vartime", &r, expected);
+
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_montgomery_ctx_destroy(&ctx, NOAHZK_variable_width_keep_ptr);
+}
+
+// a*b mod n (or a^2 mod n for sqrmod, where b is NULL) by taking a & b into Montgomery form, multiplying & taking the product back out,
+// with the default workspace & with scratch from the caller
+void NOAHZK_test_mulmod(const char* const op, const NOAHZK_variable_width_t* const a, const NOAHZK_variable_width_t* const b, const NOAHZK_variable_width_t* const n, const char* const expected){
+    NOAHZK_montgomery_ctx_t ctx;
+    if(!NOAHZK_montgomery_ctx_init(&ctx, n)){
+        NOAHZK_test_expect(0, op, "no Montgomery context for the modulus");
+        return;
+    }
+
+    const int square = !strcmp(op, "sqrmod");
+    NOAHZK_variable_width_t a_mont = NOAHZK_variable_width_INITIALISER, b_mont = NOAHZK_variable_width_INITIALISER, r = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_montgomery_ctx_init_element(&ctx, &a_mont);
+    NOAHZK_montgomery_ctx_init_element(&ctx, &b_mont);
+    NOAHZK_montgomery_ctx_init_element(&ctx, &r);
+
+    NOAHZK_variable_width_to_mont(&a_mont, a, &ctx);
+    if(square) NOAHZK_variable_width_mont_sqr(&r, &a_mont, &ctx);
+    else{
+        NOAHZK_variable_width_to_mont(&b_mont, b, &ctx);
+        NOAHZK_variable_width_mont_mul(&r, &a_mont, &b_mont, &ctx);
+    }
+    NOAHZK_variable_width_from_mont(&r, &r, &ctx);
+    NOAHZK_test_check(op, "default workspace", &r, expected);
+
+    NOAHZK_limb_t* const scratch = malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(NOAHZK_variable_width_mont_scratch_size(&ctx)));
+    NOAHZK_variable_width_to_mont_scratch(&a_mont, a, &ctx, scratch);
+    if(square) NOAHZK_variable_width_mont_sqr_scratch(&r, &a_mont, &ctx, scratch);
+    else{
+        NOAHZK_variable_width_to_mont_scratch(&b_mont, b, &ctx, scratch);
+        NOAHZK_variable_width_mont_mul_scratch(&r, &a_mont, &b_mont, &ctx, scratch);
+    }
+    NOAHZK_variable_width_from_mont_scratch(&r, &r, &ctx, scratch);
+    NOAHZK_test_check(op, "scratch", &r, expected);
+    free(scratch);
+
+    NOAHZK_variable_width_destroy(&a_mont, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&b_mont, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&r, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_montgomery_ctx_destroy(&ctx, NOAHZK_variable_width_keep_ptr);
+}
+
+// (2^bits - 1)^2 = 2^(2*bits) - 2^(bits + 1) + 1, which is (bits/4 - 1) fs, an e, (bits/4 - 1) 0s & a 1 in hex, then back down by 2^bits - 1;
+// squared from 2^bits - 1, 1 - 2^bits & -2^(bits - 1) (whose square is a 4 & bits/2 - 1 0s) too.
+// wide enough to go through the Karatsuba & Toom tiers; bits has to be a multiple of 4.
+void NOAHZK_test_square_of_ones(const size_t bits){
+    const size_t digits = bits/4;
+    char* const ones = malloc(digits + 2), *const square = malloc(2*digits + 1);
+    ones[0] = '-';
+    memset(ones + 1, 'f', digits);
+    ones[digits + 1] = '\0';
+    memset(square, 'f', digits - 1);
+    square[digits - 1] = 'e';
+    memset(square + digits, '0', digits - 1);
+    square[2*digits - 1] = '1';
+    square[2*digits] = '\0';
+
+    NOAHZK_variable_width_t a = NOAHZK_variable_width_INITIALISER, s = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_variable_width_from_hex_and_resize(&a, ones + 1);
+    NOAHZK_variable_width_from_hex_and_resize(&s, square);
+    NOAHZK_test_mul("mul", &a, &a, square);
+    NOAHZK_test_square("sqr", &a, square);
+    NOAHZK_test_divrem("div", &s, &a, ones + 1);
+    NOAHZK_test_divrem("mod", &s, &a, "0");
+    NOAHZK_variable_width_from_hex_and_resize(&a, ones);
+    NOAHZK_test_square("sqr", &a, square);
+
+    ones[1] = '8';
+    memset(ones + 2, '0', digits - 1);
+    square[0] = '4';
+    memset(square + 1, '0', 2*digits - 1);
+    NOAHZK_variable_width_from_hex_and_resize(&a, ones);
+    NOAHZK_test_square("sqr", &a, square);
+
+    NOAHZK_variable_width_destroy(&a, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&s, NOAHZK_variable_width_keep_ptr);
+    free(ones);
+    free(square);
+}
+
+// squares of width limbs, either side of a squaring tier's threshold: a fixed pattern & its negation, both against the schoolbook product
+// of the pattern with itself (which no tier above it is used for), & the unsigned dispatch on the pattern against that product directly.
+void NOAHZK_test_square_at(const size_t width){
+    NOAHZK_limb_t* const pattern = malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width)), *const product = malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(2*width));
+    NOAHZK_limb_t* const square = malloc(NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(2*width));
+    for(size_t i = 0; i < width; i++) pattern[i] = (NOAHZK_limb_t)(0x9e3779b97f4a7c15 * (uint64_t)(width + i + 1));
+    pattern[width - 1] >>= 1;
+    NOAHZK_variable_width_mul_schoolbook(product, pattern, pattern, width, width);
+    NOAHZK_variable_width_sqr_dispatch(square, pattern, width);
+    NOAHZK_test_expect(!memcmp(square, product, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(2*width)), "sqr", "dispatch");
+
+// the product as hex, & the pattern as hex & negated
+    NOAHZK_variable_width_t a = NOAHZK_variable_width_INITIALISER, s = NOAHZK_variable_width_INITIALISER;
+    NOAHZK_test_init(&s, 2*width + 1);
+    memcpy(s.arr, product, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(2*width));
+    const size_t size_square = NOAHZK_variable_width_to_hex_size(&s);
+    char* const expected = malloc(size_square);
+    NOAHZK_variable_width_to_hex(expected, size_square, &s);
+
+    NOAHZK_test_init(&a, width);
+    memcpy(a.arr, pattern, NOAHZK_GET_WIDTH_FROM_VAR_WIDTH_TYPE_INT(width));
+    const size_t size = NOAHZK_variable_width_to_hex_size(&a);
+    char* const negated = malloc(size + 1);
+    negated[0] = '-';
+    NOAHZK_variable_width_to_hex(negated + 1, size, &a);
+    NOAHZK_test_square("sqr", &a, expected);
+    NOAHZK_test_mul("mul", &a, &a, expected);
+    NOAHZK_variable_width_from_hex_and_resize(&a, negated);
+    NOAHZK_test_square("sqr", &a, expected);
+
+    NOAHZK_variable_width_destroy(&a, NOAHZK_variable_width_keep_ptr);
+    NOAHZK_variable_width_destroy(&s, NOAHZK_variable_width_keep_ptr);
+    free(pattern);
+    free(product);
+    free(square);
+    free(expected);
+    free(negated);
+}
+
+int main(void){
+    for(size_t i = 0; i < sizeof(NOAHZK_test_vectors)/sizeof(NOAHZK_test_vectors[0]); i++){
+        const NOAHZK_test_vector_t* const v = &NOAHZK_test_vectors[i];
+        NOAHZK_variable_width_t a = NOAHZK_variable_width_INITIALISER, b = NOAHZK_variable_width_INITIALISER, n = NOAHZK_variable_width_INITIALISER;
+        NOAHZK_variable_width_from_hex_and_resize(&a, v->a);
+        if(v->b) NOAHZK_variable_width_from_hex_and_resize(&b, v->b);
+
+        if(!strcmp(v->op, "add") || !strcmp(v->op, "sub")) NOAHZK_test_add(v->op, &a, &b, v->expected);
+        else if(!strcmp(v->op, "addk") || !strcmp(v->op, "subk")) NOAHZK_test_add_constant(v->op, &a, v->b, v->expected);
+        else if(!strcmp(v->op, "neg") || !strcmp(v->op, "inv")) NOAHZK_test_negate(v->op, &a, v->expected);
+        else if(!strcmp(v->op, "cmp")) NOAHZK_test_cmp(v->op, &a, &b, v->a, v->b, v->expected);
+        else if(!strcmp(v->op, "bitcnt")) NOAHZK_test_bitcnt(v->op, &a, v->a, v->expected);
+        else if(!strcmp(v->op, "mul")) NOAHZK_test_mul(v->op, &a, &b, v->expected);
+        else if(!strcmp(v->op, "div") || !strcmp(v->op, "mod")) NOAHZK_test_divrem(v->op, &a, &b, v->expected);
+        else if(!strcmp(v->op, "pow")) NOAHZK_test_pow(v->op, &a, &b, v->expected);
+        else{
+            NOAHZK_variable_width_from_hex_and_resize(&n, v->n);
+            if(!strcmp(v->op, "powmod")) NOAHZK_test_powmod(v->op, &a, &b, &n, v->expected);
+            else NOAHZK_test_mulmod(v->op, &a, v->b? &b: NULL, &n, v->expected);
+        }
+
+        NOAHZK_variable_width_destroy(&a, NOAHZK_variable_width_keep_ptr);
+        NOAHZK_variable_width_destroy(&b, NOAHZK_variable_width_keep_ptr);
+        NOAHZK_variable_width_destroy(&n, NOAHZK_variable_width_keep_ptr);
+    }
+
+    NOAHZK_test_square_of_ones(2048);
+    NOAHZK_test_square_of_ones(8192);
+    NOAHZK_test_square_of_ones(20000);
+// one limb below each squaring tier's threshold, at it (the widest the tier below takes) & just above, where there's a short top part
+    const size_t thresholds[] = {NOAHZK_SQR_KARATSUBA_THRESHOLD, NOAHZK_SQR_TOOM3_THRESHOLD, NOAHZK_SQR_TOOM4_THRESHOLD};
+    for(size_t i = 0; i < sizeof(thresholds)/sizeof(thresholds[0]); i++)
+        for(size_t width = thresholds[i] - 1; width <= thresholds[i] + 2; width++){
+            NOAHZK_test_square_at(width);
+            NOAHZK_test_square_of_ones(width*BITS_IN_NOAHZK_LIMB);
+        }
+    NOAHZK_test_bitcnt_var();
+    NOAHZK_test_dot();
+
+    return NOAHZK_test_report("vectors");
+}